@@ -15,44 +15,160 @@
 #include "err.h"
 #include "err.h"
 
+#if ERR_HW_CRC || ERR_HW_CLMUL || ERR_HW_SIMD || ERR_SUM_SWAR
+  #include <string.h>
+#endif
+#include <limits.h>
+
 /**
- * @brief Calculates 8-bit checksum for given data
- * @param _data Pointer to input data array
- * @param _dataLength Length of data in bytes
- * @return uint8_t Calculated checksum value
+ * @brief Bytes per modulo reduction of the Fletcher-16 / Adler-32 sums
+ * @details Largest multiple of 32 below zlib's NMAX (5552), the longest run
+ *          that keeps the Adler-32 sums inside 32 bits.
+ */
+#define ERR_SUM_BLOCK 5536
+
+#define ERR_FLETCHER16_BLOCK  20    ///< Bytes per fold of the 16-bit Fletcher-16 sums (16-bit int targets)
+#define ERR_FLETCHER32_WORDS  359   ///< Words per modulo reduction of the scalar Fletcher-32 sums
+#define ERR_FLETCHER32_STEPS  360   ///< 16-byte steps per reduction of the SIMD Fletcher-32 lanes
+#define ERR_INET_WORDS        32768 ///< Words per fold of the Internet checksum sum
+
+#if ERR_HW_CRC || ERR_HW_CLMUL || ERR_HW_SIMD
+  #if defined(__x86_64__)
+    #include <immintrin.h>
+    #include <nmmintrin.h>
+    #include <wmmintrin.h>
+    #include <tmmintrin.h>
+  #elif defined(__aarch64__)
+    #include <arm_acle.h>
+    #include <arm_neon.h>
+    #if defined(__linux__)
+      #include <sys/auxv.h>
+      #include <asm/hwcap.h>
+    #endif
+  #endif
+#endif
+
+
+#if ERR_HW_CRC || ERR_HW_CLMUL || ERR_HW_SIMD
+
+#define ERR_CPU_CRC    0x01  ///< CRC32 instructions (x86 SSE4.2, ARMv8 CRC32)
+#define ERR_CPU_CLMUL  0x02  ///< Carry-less multiply (x86 PCLMULQDQ + SSSE3, ARMv8 PMULL)
+#define ERR_CPU_AVX2   0x04  ///< 256-bit integer SIMD (x86 AVX2)
+#define ERR_CPU_SSSE3  0x08  ///< Byte shuffles (x86 SSSE3 PSHUFB)
+
+/**
+ * @brief Detects the CPU features used by the hardware backends
+ * @return uint8_t Bit mask of ERR_CPU_xxx flags
  * 
- * @note This is a simple additive checksum that may not detect all errors
- *       but is computationally inexpensive.
+ * @note The CPU is probed only on the first call, the result is cached.
+ *       The cache is read and written atomically, so threads racing on the
+ *       first call just probe twice and store the same value.
  */
-uint8_t checkSum8_Calc(uint8_t *_data, uint16_t _dataLength)
+static uint8_t err_CpuDetect(void)
 {
-    uint8_t _Sum = 0x00;
-    uint16_t _index = 0x00;
+    static int16_t _cpuFeatures = -1;
+    int16_t _cached = __atomic_load_n(&_cpuFeatures, __ATOMIC_RELAXED);
+    uint8_t _features = 0x00;
 
-    for(_index = 0; _index < _dataLength; _index++)
+    if(_cached < 0)
     {
-        _Sum += _data[_index];
+#if defined(__x86_64__)
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("sse4.2"))
+        {
+            _features |= ERR_CPU_CRC;
+        };
+        if(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3"))
+        {
+            _features |= ERR_CPU_CLMUL;
+        };
+        if(__builtin_cpu_supports("avx2"))
+        {
+            _features |= ERR_CPU_AVX2;
+        };
+        if(__builtin_cpu_supports("ssse3"))
+        {
+            _features |= ERR_CPU_SSSE3;
+        };
+#elif defined(__APPLE__)
+        _features = ERR_CPU_CRC | ERR_CPU_CLMUL;
+#elif defined(__linux__)
+        unsigned long _hwcap = getauxval(AT_HWCAP);
+  #if defined(HWCAP_CRC32)
+        if(_hwcap & HWCAP_CRC32)
+        {
+            _features |= ERR_CPU_CRC;
+        };
+  #endif
+  #if defined(HWCAP_PMULL)
+        if(_hwcap & HWCAP_PMULL)
+        {
+            _features |= ERR_CPU_CLMUL;
+        };
+  #endif
+#else
+  #if defined(__ARM_FEATURE_CRC32)
+        _features |= ERR_CPU_CRC;
+  #endif
+  #if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+        _features |= ERR_CPU_CLMUL;
+  #endif
+#endif
+        _cached = _features;
+        __atomic_store_n(&_cpuFeatures, _cached, __ATOMIC_RELAXED);
     };
 
-    return _Sum;
+    return (uint8_t)_cached;
 };
 
+#endif /* ERR_HW_CRC || ERR_HW_CLMUL || ERR_HW_SIMD */
+
+
+#if ERR_HW_SIMD
 
 /**
- * @brief Calculates 16-bit checksum for given data
+ * @brief Sums all bytes of a buffer with SSE2 / NEON horizontal byte sums
  * @param _data Pointer to input data array
  * @param _dataLength Length of data in bytes
- * @return uint16_t Calculated checksum value
+ * @return uint64_t Sum of all bytes, without wraparound
  * 
- * @note Provides better error detection than 8-bit checksum
- *       while maintaining simplicity.
+ * @note x86 PSADBW against zero adds 8 bytes into a 64-bit lane per
+ *       instruction; NEON pairwise-widening adds do the same in steps.
  */
-uint16_t checkSum16_Calc(uint8_t *_data, uint16_t _dataLength)
+static uint64_t err_SimdByteSum(const uint8_t *_data, size_t _dataLength)
 {
-    uint16_t _Sum = 0x00;
-    uint16_t _index = 0x00;
+    uint64_t _Sum = 0x00;
+    size_t _index = 0x00;
+#if defined(__x86_64__)
+    __m128i _zero = _mm_setzero_si128();
+    __m128i _acc0 = _mm_setzero_si128();
+    __m128i _acc1 = _mm_setzero_si128();
 
-    for(_index = 0; _index < _dataLength; _index++)
+    for(; (_dataLength - _index) >= 32; _index += 32)
+    {
+        _acc0 = _mm_add_epi64(_acc0, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(_data + _index)), _zero));
+        _acc1 = _mm_add_epi64(_acc1, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(_data + _index + 16)), _zero));
+    };
+
+    _acc0 = _mm_add_epi64(_acc0, _acc1);
+    _Sum = (uint64_t)_mm_cvtsi128_si64(_acc0) + (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(_acc0, _acc0));
+#else
+    uint64x2_t _acc = vdupq_n_u64(0);
+    uint16x8_t _acc16;
+
+    for(; (_dataLength - _index) >= 64; _index += 64)
+    {
+        _acc16 = vpaddlq_u8(vld1q_u8(_data + _index));
+        _acc16 = vpadalq_u8(_acc16, vld1q_u8(_data + _index + 16));
+        _acc16 = vpadalq_u8(_acc16, vld1q_u8(_data + _index + 32));
+        _acc16 = vpadalq_u8(_acc16, vld1q_u8(_data + _index + 48));
+        _acc = vpadalq_u32(_acc, vpaddlq_u16(_acc16));
+    };
+
+    _Sum = vgetq_lane_u64(_acc, 0) + vgetq_lane_u64(_acc, 1);
+#endif
+
+    for(; _index < _dataLength; _index++)
     {
         _Sum += _data[_index];
     };
@@ -61,214 +177,6425 @@ uint16_t checkSum16_Calc(uint8_t *_data, uint16_t _dataLength)
 };
 
 
+#if defined(__x86_64__)
 /**
- * @brief Calculates 32-bit checksum for given data
+ * @brief Sums all bytes of a buffer with AVX2 horizontal byte sums
  * @param _data Pointer to input data array
  * @param _dataLength Length of data in bytes
- * @return uint32_t Calculated checksum value
- * 
- * @note Provides the highest level of error detection among
- *       the simple checksum implementations.
+ * @return uint64_t Sum of all bytes, without wraparound
  */
-uint32_t checkSum32_Calc(uint8_t *_data, uint16_t _dataLength)
+__attribute__((target("avx2"))) static uint64_t err_Avx2ByteSum(const uint8_t *_data, size_t _dataLength)
 {
-    uint32_t _Sum = 0x00;
-    uint16_t _index = 0x00;
+    __m256i _zero = _mm256_setzero_si256();
+    __m256i _acc0 = _mm256_setzero_si256();
+    __m256i _acc1 = _mm256_setzero_si256();
+    __m128i _acc;
+    size_t _index = 0x00;
 
-    for(_index = 0; _index < _dataLength; _index++)
+    for(; (_dataLength - _index) >= 64; _index += 64)
     {
-        _Sum += _data[_index];
+        _acc0 = _mm256_add_epi64(_acc0, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *)(_data + _index)), _zero));
+        _acc1 = _mm256_add_epi64(_acc1, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *)(_data + _index + 32)), _zero));
     };
 
-    return _Sum;
+    _acc0 = _mm256_add_epi64(_acc0, _acc1);
+    _acc = _mm_add_epi64(_mm256_castsi256_si128(_acc0), _mm256_extracti128_si256(_acc0, 1));
+
+    return (uint64_t)_mm_cvtsi128_si64(_acc) + (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(_acc, _acc))
+         + err_SimdByteSum(_data + _index, _dataLength - _index);
 };
+#endif
 
 
+#if defined(__x86_64__)
 /**
- * @brief Reflects the bits of input data
- * @param _data Input data to be reflected
- * @param _dataBits Number of bits to reflect (8, 16, or 32)
- * @return uint32_t Bit-reflected output
+ * @brief Adds the four 32-bit lanes of a vector
+ * @param _vector Input vector
+ * @return uint32_t Sum of the lanes modulo 2^32
+ */
+static inline uint32_t err_HSum32(__m128i _vector)
+{
+    _vector = _mm_add_epi32(_vector, _mm_shuffle_epi32(_vector, 0x4E));
+    _vector = _mm_add_epi32(_vector, _mm_shuffle_epi32(_vector, 0xB1));
+
+    return (uint32_t)_mm_cvtsi128_si32(_vector);
+};
+#endif
+
+
+/**
+ * @brief Advances a Fletcher / Adler byte sum pair over 32-byte chunks
+ * @param _data Pointer to input data array
+ * @param _chunks Number of 32-byte chunks (at most ERR_SUM_BLOCK / 32)
+ * @param _Sum1 Running byte sum, advanced without reduction
+ * @param _Sum2 Running sum of _Sum1, advanced without reduction
  * 
- * @note Used internally for CRC calculations when input/output
- *       reflection is required by the CRC standard.
+ * @note For n bytes d[0] .. d[n-1] the pair advances by
+ *       Sum1 += d[0] + ... + d[n-1] and
+ *       Sum2 += n * Sum1 + n * d[0] + (n - 1) * d[1] + ... + 1 * d[n-1].
+ *       Every chunk adds its byte sum (PSADBW / pairwise adds) and its
+ *       sum weighted 32 .. 1 (PMADDWD / widening multiply-add); the byte
+ *       sum before the chunk is accumulated once per chunk and weighted
+ *       by 32 at the end, which gives the cross terms of the whole run.
  */
-uint32_t bitReflected(uint32_t _data, uint8_t _dataBits)
+static void err_SimdFletcherSum(const uint8_t *_data, size_t _chunks, uint32_t *_Sum1, uint32_t *_Sum2)
 {
-    uint32_t _temp = 0x00;
-    uint8_t _index = 0x00;
-    _dataBits--;
+    uint32_t _Sum1Start = *_Sum1;
+    uint32_t _Bytes = 0x00;
+    uint32_t _Prefix = 0x00;
+    uint32_t _Weighted = 0x00;
+    size_t _index = 0x00;
+#if defined(__x86_64__)
+    const __m128i _zero = _mm_setzero_si128();
+    const __m128i _w0 = _mm_setr_epi16(32, 31, 30, 29, 28, 27, 26, 25);
+    const __m128i _w1 = _mm_setr_epi16(24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i _w2 = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    const __m128i _w3 = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+    __m128i _vBytes = _mm_setzero_si128();
+    __m128i _vPrefix = _mm_setzero_si128();
+    __m128i _vWeighted = _mm_setzero_si128();
+    __m128i _b0, _b1;
 
-    for(_index = 0; _index <= _dataBits; _index++)
+    for(_index = 0; _index < _chunks; _index++, _data += 32)
     {
-        bitChange(_temp, (_dataBits-_index), bitCheck(_data, _index));
-    }
+        _b0 = _mm_loadu_si128((const __m128i *)_data);
+        _b1 = _mm_loadu_si128((const __m128i *)(_data + 16));
+
+        _vPrefix = _mm_add_epi32(_vPrefix, _vBytes);
+        _vBytes = _mm_add_epi32(_vBytes, _mm_add_epi32(_mm_sad_epu8(_b0, _zero), _mm_sad_epu8(_b1, _zero)));
+
+        _vWeighted = _mm_add_epi32(_vWeighted, _mm_madd_epi16(_mm_unpacklo_epi8(_b0, _zero), _w0));
+        _vWeighted = _mm_add_epi32(_vWeighted, _mm_madd_epi16(_mm_unpackhi_epi8(_b0, _zero), _w1));
+        _vWeighted = _mm_add_epi32(_vWeighted, _mm_madd_epi16(_mm_unpacklo_epi8(_b1, _zero), _w2));
+        _vWeighted = _mm_add_epi32(_vWeighted, _mm_madd_epi16(_mm_unpackhi_epi8(_b1, _zero), _w3));
+    };
+
+    _Bytes = err_HSum32(_vBytes);
+    _Prefix = err_HSum32(_vPrefix);
+    _Weighted = err_HSum32(_vWeighted);
+#else
+    static const uint16_t _weights[32] = {32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                          16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1};
+    uint32x4_t _vBytes = vdupq_n_u32(0);
+    uint32x4_t _vPrefix = vdupq_n_u32(0);
+    uint32x4_t _vWeighted;
+    uint16x8_t _c0 = vdupq_n_u16(0);
+    uint16x8_t _c1 = vdupq_n_u16(0);
+    uint16x8_t _c2 = vdupq_n_u16(0);
+    uint16x8_t _c3 = vdupq_n_u16(0);
+    uint16x8_t _w;
+    uint8x16_t _b0, _b1;
 
-    return _temp;
+    for(_index = 0; _index < _chunks; _index++, _data += 32)
+    {
+        _b0 = vld1q_u8(_data);
+        _b1 = vld1q_u8(_data + 16);
+
+        _vPrefix = vaddq_u32(_vPrefix, _vBytes);
+        _vBytes = vpadalq_u16(_vBytes, vpadalq_u8(vpaddlq_u8(_b0), _b1));
+
+        _c0 = vaddw_u8(_c0, vget_low_u8(_b0));
+        _c1 = vaddw_high_u8(_c1, _b0);
+        _c2 = vaddw_u8(_c2, vget_low_u8(_b1));
+        _c3 = vaddw_high_u8(_c3, _b1);
+    };
+
+    _w = vld1q_u16(_weights);
+    _vWeighted = vmull_u16(vget_low_u16(_c0), vget_low_u16(_w));
+    _vWeighted = vmlal_high_u16(_vWeighted, _c0, _w);
+    _w = vld1q_u16(_weights + 8);
+    _vWeighted = vmlal_u16(_vWeighted, vget_low_u16(_c1), vget_low_u16(_w));
+    _vWeighted = vmlal_high_u16(_vWeighted, _c1, _w);
+    _w = vld1q_u16(_weights + 16);
+    _vWeighted = vmlal_u16(_vWeighted, vget_low_u16(_c2), vget_low_u16(_w));
+    _vWeighted = vmlal_high_u16(_vWeighted, _c2, _w);
+    _w = vld1q_u16(_weights + 24);
+    _vWeighted = vmlal_u16(_vWeighted, vget_low_u16(_c3), vget_low_u16(_w));
+    _vWeighted = vmlal_high_u16(_vWeighted, _c3, _w);
+
+    _Bytes = vaddvq_u32(_vBytes);
+    _Prefix = vaddvq_u32(_vPrefix);
+    _Weighted = vaddvq_u32(_vWeighted);
+#endif
+
+    *_Sum1 = _Sum1Start + _Bytes;
+    *_Sum2 += ((uint32_t)_chunks * 32 * _Sum1Start) + (32 * _Prefix) + _Weighted;
 };
 
 
 /**
- * @brief Calculates 8-bit CRC value
- * @param hcrc Pointer to CRC8 configuration structure
- * @param _data Pointer to input data array
- * @param _dataLength Length of data in bytes
- * @return uint8_t Calculated CRC value
+ * @brief Advances a Fletcher-32 sum pair over 16-byte steps
+ * @param _data Pointer to input data array (16-bit little endian words)
+ * @param _steps Number of 16-byte steps (at most ERR_FLETCHER32_STEPS)
+ * @param _Sum1 Running word sum (mod 65535), reduced on return
+ * @param _Sum2 Running sum of _Sum1 (mod 65535), reduced on return
  * 
- * @note Implements standard CRC-8 algorithm with configurable:
- *       - Polynomial
- *       - Initial value
- *       - Input/output reflection
- *       - Final XOR
+ * @note Eight 32-bit lanes run their own Fletcher sums A[l], B[l] over the
+ *       words l, l + 8, l + 16, ... A word j of the run is counted
+ *       N - j = 8 * (M - m) - l times in Sum2 (N words, M steps, j = 8m + l),
+ *       so the lanes merge as Sum2 += N * Sum1 + sum(8 * B[l] - l * A[l]).
  */
-uint8_t CRC8_Calc(hcrc8_T *hcrc, uint8_t *_data, uint16_t _dataLength)
+static void err_SimdFletcher32Sum(const uint8_t *_data, size_t _steps, uint32_t *_Sum1, uint32_t *_Sum2)
 {
-    uint8_t _CRC = hcrc->Init;
-    uint8_t _bitIndex  = 0x00;
-    uint16_t _dataIndex = 0x00;
-    uint8_t _dataTemp  = 0x00;
+    uint32_t _A[8];
+    uint32_t _B[8];
+    uint64_t _s1 = *_Sum1;
+    uint64_t _s2 = *_Sum2;
+    size_t _index = 0x00;
+#if defined(__x86_64__)
+    const __m128i _zero = _mm_setzero_si128();
+    __m128i _a0 = _mm_setzero_si128();
+    __m128i _a1 = _mm_setzero_si128();
+    __m128i _b0 = _mm_setzero_si128();
+    __m128i _b1 = _mm_setzero_si128();
+    __m128i _words;
 
-    for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+    for(_index = 0; _index < _steps; _index++, _data += 16)
     {
-        _dataTemp = _data[_dataIndex];
-        if(hcrc->refIn)
-        {
-           _dataTemp = (uint8_t) bitReflected(_dataTemp, 8);
-        }
+        _words = _mm_loadu_si128((const __m128i *)_data);
+        _a0 = _mm_add_epi32(_a0, _mm_unpacklo_epi16(_words, _zero));
+        _a1 = _mm_add_epi32(_a1, _mm_unpackhi_epi16(_words, _zero));
+        _b0 = _mm_add_epi32(_b0, _a0);
+        _b1 = _mm_add_epi32(_b1, _a1);
+    };
 
-        _CRC ^= _dataTemp;
+    _mm_storeu_si128((__m128i *)&_A[0], _a0);
+    _mm_storeu_si128((__m128i *)&_A[4], _a1);
+    _mm_storeu_si128((__m128i *)&_B[0], _b0);
+    _mm_storeu_si128((__m128i *)&_B[4], _b1);
+#else
+    uint32x4_t _a0 = vdupq_n_u32(0);
+    uint32x4_t _a1 = vdupq_n_u32(0);
+    uint32x4_t _b0 = vdupq_n_u32(0);
+    uint32x4_t _b1 = vdupq_n_u32(0);
+    uint16x8_t _words;
 
-        for(_bitIndex = 0; _bitIndex < 8; _bitIndex++)
-        {
-            if(bitCheckHigh(_CRC, 7))
-            {
-                bitShiftLeft(_CRC, 1);
-                _CRC ^= hcrc->Poly;
-            }
-            else
-            {
-                bitShiftLeft(_CRC, 1);
-            };
-        };
+    for(_index = 0; _index < _steps; _index++, _data += 16)
+    {
+        _words = vreinterpretq_u16_u8(vld1q_u8(_data));
+        _a0 = vaddw_u16(_a0, vget_low_u16(_words));
+        _a1 = vaddw_high_u16(_a1, _words);
+        _b0 = vaddq_u32(_b0, _a0);
+        _b1 = vaddq_u32(_b1, _a1);
     };
 
-    _CRC ^= hcrc->xorOut;  
-    if(hcrc->refOut)
+    vst1q_u32(&_A[0], _a0);
+    vst1q_u32(&_A[4], _a1);
+    vst1q_u32(&_B[0], _b0);
+    vst1q_u32(&_B[4], _b1);
+#endif
+
+    _s2 += (uint64_t)_steps * 8 * _s1;
+    for(_index = 0; _index < 8; _index++)
     {
-        _CRC = (uint8_t) bitReflected(_CRC, 8);
-    }
+        _s1 += _A[_index];
+        _s2 += (8 * (uint64_t)_B[_index]) - (_index * (uint64_t)_A[_index]);
+    };
 
-    return _CRC;
+    *_Sum1 = (uint32_t)(_s1 % 65535);
+    *_Sum2 = (uint32_t)(_s2 % 65535);
 };
 
 
 /**
- * @brief Calculates 16-bit CRC value
- * @param hcrc Pointer to CRC8 configuration structure
+ * @brief Sums 16-bit little endian words over 16-byte steps
  * @param _data Pointer to input data array
- * @param _dataLength Length of data in bytes
- * @return uint16_t Calculated CRC value
+ * @param _steps Number of 16-byte steps
+ * @return uint64_t Sum of all words, without wraparound
  * 
- * @note Implements standard CRC-16 algorithm with configurable:
- *       - Polynomial
- *       - Initial value
- *       - Input/output reflection
- *       - Final XOR
+ * @note Each 32-bit lane takes one word per step, so the lanes are moved
+ *       into the 64-bit total every 65536 steps before they can overflow.
  */
-uint16_t CRC16_Calc(hcrc16_T *hcrc, uint8_t *_data, uint16_t _dataLength)
+static uint64_t err_SimdWordSum(const uint8_t *_data, size_t _steps)
 {
-    uint16_t _CRC = hcrc->Init;
-    uint16_t _bitIndex  = 0x00;
-    uint16_t _dataIndex = 0x00;
-    uint8_t _dataTemp  = 0x00;
+    uint64_t _Sum = 0x00;
+    size_t _block = 0x00;
+#if defined(__x86_64__)
+    const __m128i _zero = _mm_setzero_si128();
+    __m128i _a0, _a1, _words;
 
-    for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+    while(_steps > 0)
     {
-        _dataTemp = _data[_dataIndex];
+        _block = (_steps > 65536) ? 65536 : _steps;
+        _steps -= _block;
+        _a0 = _mm_setzero_si128();
+        _a1 = _mm_setzero_si128();
 
-        if(hcrc->refIn)
+        for(; _block > 0; _block--, _data += 16)
         {
-            _dataTemp = bitReflected(_dataTemp, 8);
+            _words = _mm_loadu_si128((const __m128i *)_data);
+            _a0 = _mm_add_epi32(_a0, _mm_unpacklo_epi16(_words, _zero));
+            _a1 = _mm_add_epi32(_a1, _mm_unpackhi_epi16(_words, _zero));
         };
 
-        _CRC ^= ((uint16_t)_dataTemp<<8);
+        _a0 = _mm_add_epi64(_mm_unpacklo_epi32(_a0, _zero), _mm_unpackhi_epi32(_a0, _zero));
+        _a0 = _mm_add_epi64(_a0, _mm_add_epi64(_mm_unpacklo_epi32(_a1, _zero), _mm_unpackhi_epi32(_a1, _zero)));
+        _Sum += (uint64_t)_mm_cvtsi128_si64(_a0) + (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(_a0, _a0));
+    };
+#else
+    uint32x4_t _a0, _a1;
+    uint16x8_t _words;
 
-        for(_bitIndex = 0; _bitIndex < 8; _bitIndex++)
+    while(_steps > 0)
+    {
+        _block = (_steps > 65536) ? 65536 : _steps;
+        _steps -= _block;
+        _a0 = vdupq_n_u32(0);
+        _a1 = vdupq_n_u32(0);
+
+        for(; _block > 0; _block--, _data += 16)
         {
-            if(bitCheckHigh(_CRC, 15))
-            {
-                bitShiftLeft(_CRC, 1);
-                _CRC ^= hcrc->Poly;
-            }
-            else
-            {
-                _CRC <<= 1;
-            };
+            _words = vreinterpretq_u16_u8(vld1q_u8(_data));
+            _a0 = vaddw_u16(_a0, vget_low_u16(_words));
+            _a1 = vaddw_high_u16(_a1, _words);
         };
-    };
 
-    _CRC ^= hcrc->xorOut; 
-
-    if(hcrc->refOut)
-    {
-        _CRC = (uint16_t) bitReflected(_CRC, 16);
+        _Sum += vaddlvq_u32(_a0) + vaddlvq_u32(_a1);
     };
+#endif
 
-    return _CRC;
+    return _Sum;
 };
 
+#endif /* ERR_HW_SIMD */
+
+
+#if ERR_SUM_SWAR
 
 /**
- * @brief Calculates 32-bit CRC value
- * @param hcrc Pointer to CRC8 configuration structure
+ * @brief Sums all bytes of a buffer one aligned 32-bit word at a time
  * @param _data Pointer to input data array
  * @param _dataLength Length of data in bytes
- * @return uint32_t Calculated CRC value
+ * @return uint32_t Sum of all bytes modulo 2^32; every checksum width is
+ *         this sum truncated to its own width
  * 
- * @note Implements standard CRC-32 algorithm with configurable:
- *       - Polynomial
- *       - Initial value
- *       - Input/output reflection
- *       - Final XOR
+ * @note Bytes are added one by one until the pointer is word aligned, then
+ *       four bytes per load: USADA8 when the core has the DSP extension
+ *       (Cortex-M4/M7/M33), otherwise the even and odd bytes are masked into
+ *       two 16-bit lanes that can absorb 128 words before being folded.
  */
-uint32_t CRC32_Calc(hcrc32_T *hcrc, uint8_t *_data, uint16_t _dataLength)
+static uint32_t err_SwarByteSum(const uint8_t *_data, size_t _dataLength)
 {
-    uint32_t _CRC = hcrc->Init;
-    uint32_t _bitIndex  = 0x00;
-    uint32_t _dataIndex = 0x00;
-    uint8_t _dataTemp  = 0x00;
+    uint32_t _Sum = 0x00;
+    uint32_t _Word = 0x00;
+    size_t _wordCount = 0x00;
+#if !defined(__ARM_FEATURE_DSP)
+    uint32_t _Lanes = 0x00;
+    size_t _blockCount = 0x00;
+#endif
 
-    for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+    for(; (_dataLength > 0) && (((uintptr_t)_data) & 0x03); _dataLength--, _data++)
     {
-        _dataTemp = _data[_dataIndex];
+        _Sum += *_data;
+    };
 
-        if(hcrc->refIn)
-        {
-            _dataTemp = bitReflected(_dataTemp, 8);
-        };
+    _wordCount = _dataLength >> 2;
+    _dataLength &= 0x03;
 
-        _CRC ^= ((uint32_t)_dataTemp)<<24;
+#if defined(__ARM_FEATURE_DSP)
+    for(; _wordCount > 0; _wordCount--, _data += 4)
+    {
+        memcpy(&_Word, _data, 4);
+        __asm__ ("usada8 %0, %1, %2, %0" : "+r" (_Sum) : "r" (_Word), "r" (0));
+    };
+#else
+    while(_wordCount > 0)
+    {
+        _blockCount = (_wordCount > 128) ? 128 : _wordCount;
+        _wordCount -= _blockCount;
+        _Lanes = 0x00;
 
-        for(_bitIndex = 0; _bitIndex < 8; _bitIndex++)
+        for(; _blockCount > 0; _blockCount--, _data += 4)
         {
-            if(bitCheckHigh(_CRC, 31))
-            {
-                bitShiftLeft(_CRC, 1);
-                _CRC ^= hcrc->Poly;
-            }
-            else
-            {
-                _CRC <<= 1;
-            };
+            memcpy(&_Word, _data, 4);
+            _Lanes += (_Word & 0x00FF00FFUL) + ((_Word >> 8) & 0x00FF00FFUL);
         };
+
+        _Sum += (_Lanes & 0xFFFF) + (_Lanes >> 16);
+    };
+#endif
+
+    for(; _dataLength > 0; _dataLength--, _data++)
+    {
+        _Sum += *_data;
+    };
+
+    return _Sum;
+};
+
+#endif /* ERR_SUM_SWAR */
+
+
+#if ERR_STATS
+
+#if (defined(__x86_64__) || defined(__aarch64__)) && defined(__GNUC__)
+  #if !defined(ERR_STATS_CYCLES_T)
+    #define ERR_STATS_CYCLES_T  uint64_t
+  #endif
+  #define ERR_STATS_ADD(_counter, _value)  __atomic_fetch_add(&(_counter), _value, __ATOMIC_RELAXED)
+  #define ERR_STATS_LOAD(_counter)         __atomic_load_n(&(_counter), __ATOMIC_RELAXED)
+  #define ERR_STATS_CLEAR(_counter)        __atomic_store_n(&(_counter), 0, __ATOMIC_RELAXED)
+#else
+  #if !defined(ERR_STATS_CYCLES_T)
+    #define ERR_STATS_CYCLES_T  uint32_t
+  #endif
+  #define ERR_STATS_ADD(_counter, _value)  ((_counter) += (_value))
+  #define ERR_STATS_LOAD(_counter)         (_counter)
+  #define ERR_STATS_CLEAR(_counter)        ((_counter) = 0)
+#endif
+
+#if !defined(ERR_STATS_CYCLES)
+  #if defined(__x86_64__) && defined(__GNUC__)
+    #define ERR_STATS_CYCLES()  __builtin_ia32_rdtsc()
+  #elif defined(__aarch64__) && defined(__GNUC__)
+/**
+ * @brief Reads the AArch64 virtual counter
+ * @return uint64_t Counter ticks
+ */
+static inline uint64_t err_StatsTicks(void)
+{
+    uint64_t _ticks = 0x00;
+
+    __asm__ volatile ("mrs %0, cntvct_el0" : "=r" (_ticks));
+
+    return _ticks;
+};
+    #define ERR_STATS_CYCLES()  err_StatsTicks()
+  #else
+    #define ERR_STATS_CYCLES()  0
+  #endif
+#endif
+
+#if !defined(ERR_TRACE_BEGIN)
+  #define ERR_TRACE_BEGIN(_algo, _length)
+#endif
+
+#if !defined(ERR_TRACE_END)
+  #define ERR_TRACE_END(_algo, _kernel, _result)
+#endif
+
+static errStats_T err_Stats;   ///< Instrumentation counters
+
+/**
+ * @brief Starts an instrumented call
+ * @param _algo Algorithm of the call
+ * @param _length Bytes the call processes
+ * @return ERR_STATS_CYCLES_T Cycle counter at the start
+ */
+static inline ERR_STATS_CYCLES_T err_StatsBegin(errAlgo_T _algo, size_t _length)
+{
+    (void)_algo;
+    (void)_length;
+    ERR_TRACE_BEGIN(_algo, _length);
+
+    return (ERR_STATS_CYCLES_T)ERR_STATS_CYCLES();
+};
+
+
+/**
+ * @brief Ends an instrumented call: adds it to its algorithm and kernel counters
+ * @param _algo Algorithm of the call
+ * @param _kernel Kernel that ran
+ * @param _length Bytes the call processed
+ * @param _result Result of the call, passed to ERR_TRACE_END
+ * @param _start Cycle counter returned by err_StatsBegin
+ * @return uint64_t _result
+ */
+static uint64_t err_StatsEnd(errAlgo_T _algo, errKernel_T _kernel, size_t _length, uint64_t _result, ERR_STATS_CYCLES_T _start)
+{
+    ERR_STATS_CYCLES_T _cycles = (ERR_STATS_CYCLES_T)((ERR_STATS_CYCLES_T)ERR_STATS_CYCLES() - _start);
+
+    ERR_STATS_ADD(err_Stats.Algo[_algo].Calls, 1);
+    ERR_STATS_ADD(err_Stats.Algo[_algo].Bytes, _length);
+    ERR_STATS_ADD(err_Stats.Algo[_algo].Cycles, _cycles);
+    ERR_STATS_ADD(err_Stats.Kernel[_kernel].Calls, 1);
+    ERR_STATS_ADD(err_Stats.Kernel[_kernel].Bytes, _length);
+    ERR_STATS_ADD(err_Stats.Kernel[_kernel].Cycles, _cycles);
+    ERR_TRACE_END(_algo, _kernel, _result);
+
+    return _result;
+};
+
+
+/**
+ * @brief Counts a checked frame
+ * @param _valid true when its CRC matched
+ * @return bool _valid
+ */
+static bool err_StatsVerify(bool _valid)
+{
+    ERR_STATS_ADD(err_Stats.Verified, 1);
+    if(!_valid)
+    {
+        ERR_STATS_ADD(err_Stats.Mismatches, 1);
     };
 
-    _CRC ^= hcrc->xorOut; 
+    return _valid;
+};
+
+
+/**
+ * @brief Reads the instrumentation counters
+ * @param hstats Pointer to the structure receiving the snapshot
+ * 
+ * @note Each counter is read atomically on hosts; counters of calls that run
+ *       meanwhile may or may not be included.
+ */
+void err_StatsGet(errStats_T *hstats)
+{
+    uint8_t _index = 0x00;
 
-    if(hcrc->refOut)
+    for(_index = 0; _index < ERR_ALGO_COUNT; _index++)
     {
-        _CRC = (uint32_t) bitReflected(_CRC, 32);
+        hstats->Algo[_index].Calls = ERR_STATS_LOAD(err_Stats.Algo[_index].Calls);
+        hstats->Algo[_index].Bytes = ERR_STATS_LOAD(err_Stats.Algo[_index].Bytes);
+        hstats->Algo[_index].Cycles = ERR_STATS_LOAD(err_Stats.Algo[_index].Cycles);
     };
 
-    return _CRC;
+    for(_index = 0; _index < ERR_KERNEL_COUNT; _index++)
+    {
+        hstats->Kernel[_index].Calls = ERR_STATS_LOAD(err_Stats.Kernel[_index].Calls);
+        hstats->Kernel[_index].Bytes = ERR_STATS_LOAD(err_Stats.Kernel[_index].Bytes);
+        hstats->Kernel[_index].Cycles = ERR_STATS_LOAD(err_Stats.Kernel[_index].Cycles);
+    };
+
+    hstats->Verified = ERR_STATS_LOAD(err_Stats.Verified);
+    hstats->Mismatches = ERR_STATS_LOAD(err_Stats.Mismatches);
+};
+
+
+/**
+ * @brief Clears the instrumentation counters
+ */
+void err_StatsReset(void)
+{
+    uint8_t _index = 0x00;
+
+    for(_index = 0; _index < ERR_ALGO_COUNT; _index++)
+    {
+        ERR_STATS_CLEAR(err_Stats.Algo[_index].Calls);
+        ERR_STATS_CLEAR(err_Stats.Algo[_index].Bytes);
+        ERR_STATS_CLEAR(err_Stats.Algo[_index].Cycles);
+    };
+
+    for(_index = 0; _index < ERR_KERNEL_COUNT; _index++)
+    {
+        ERR_STATS_CLEAR(err_Stats.Kernel[_index].Calls);
+        ERR_STATS_CLEAR(err_Stats.Kernel[_index].Bytes);
+        ERR_STATS_CLEAR(err_Stats.Kernel[_index].Cycles);
+    };
+
+    ERR_STATS_CLEAR(err_Stats.Verified);
+    ERR_STATS_CLEAR(err_Stats.Mismatches);
 };
+
+/**
+ * @brief Instrumentation of an entry point
+ * @details ERR_STATS_BEGIN is the last declaration of the function (it
+ *          declares the start time and keeps the length, so the function
+ *          may consume its arguments); ERR_STATS_END wraps the result
+ *          expression and returns it as uint64_t, ERR_STATS_DONE ends a
+ *          function without a result, ERR_STATS_CHECK wraps the result of
+ *          a verify and also counts the checked frame, ERR_STATS_VERIFY only
+ *          counts the checked frame. ERR_STATS_SUM_KERNEL names the kernel
+ *          of the Fletcher, Adler and Internet sums, which use the SIMD
+ *          engine from _simdLength bytes on. Without ERR_STATS they leave
+ *          the code unchanged.
+ */
+#define ERR_STATS_BEGIN(_algo, _length)             ERR_STATS_CYCLES_T _statsStart = err_StatsBegin(_algo, _length); \
+                                                    size_t _statsLength = (_length)
+#define ERR_STATS_END(_algo, _kernel, _result)      err_StatsEnd(_algo, _kernel, _statsLength, (uint64_t)(_result), _statsStart)
+#define ERR_STATS_DONE(_algo, _kernel)              ((void)err_StatsEnd(_algo, _kernel, _statsLength, 0, _statsStart))
+#define ERR_STATS_CHECK(_algo, _kernel, _valid)     err_StatsVerify(err_StatsEnd(_algo, _kernel, _statsLength, (_valid) ? 1 : 0, _statsStart) != 0)
+#define ERR_STATS_VERIFY(_valid)                    err_StatsVerify(_valid)
+
+#if ERR_HW_SIMD
+  #define ERR_STATS_SUM_KERNEL(_simdLength)         ((_statsLength >= (_simdLength)) ? ERR_KERNEL_SIMD : ERR_KERNEL_SCALAR)
+#else
+  #define ERR_STATS_SUM_KERNEL(_simdLength)         ERR_KERNEL_SCALAR
+#endif
+
+#else
+
+#define ERR_STATS_BEGIN(_algo, _length)
+#define ERR_STATS_END(_algo, _kernel, _result)      (_result)
+#define ERR_STATS_DONE(_algo, _kernel)              ((void)0)
+#define ERR_STATS_CHECK(_algo, _kernel, _valid)     (_valid)
+#define ERR_STATS_VERIFY(_valid)                    (_valid)
+
+#endif /* ERR_STATS */
+
+
+#if (defined(__x86_64__) || defined(__aarch64__)) && defined(__GNUC__)
+  #define ERR_KERNEL_LOAD(_kernel)           __atomic_load_n(&(_kernel), __ATOMIC_RELAXED)
+  #define ERR_KERNEL_STORE(_kernel, _value)  __atomic_store_n(&(_kernel), _value, __ATOMIC_RELAXED)
+#else
+  #define ERR_KERNEL_LOAD(_kernel)           (_kernel)
+  #define ERR_KERNEL_STORE(_kernel, _value)  ((_kernel) = (_value))
+#endif
+
+/**
+ * @brief Checksum kernel: sum of all bytes modulo 2^32
+ * @details Every checksum width is this sum truncated to its own width;
+ *          _ran receives the kernel that processed the data.
+ */
+typedef uint32_t (*errSumKernel_T)(const uint8_t *_data, size_t _dataLength, errKernel_T *_ran);
+
+static errKernel_T err_KernelId[ERR_DISPATCH_COUNT];    ///< Selected kernel per family (AUTO until set)
+
+
+#if ERR_SUM_SWAR || ERR_HW_SIMD
+
+/**
+ * @brief Sums all bytes of a buffer one byte at a time
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Sum of all bytes modulo 2^32
+ */
+static uint32_t err_ScalarByteSum(const uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Sum = 0x00;
+
+    for(; _dataLength > 0; _dataLength--, _data++)
+    {
+        _Sum += *_data;
+    };
+
+    return _Sum;
+};
+
+#endif
+
+
+#if ERR_SUM_SWAR
+/**
+ * @brief Checksum kernel ERR_KERNEL_SWAR (byte loop below 16 bytes)
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Sum of all bytes modulo 2^32
+ */
+static uint32_t err_SumSwar(const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    *_ran = (_dataLength >= 16) ? ERR_KERNEL_SWAR : ERR_KERNEL_SCALAR;
+
+    return (_dataLength >= 16) ? err_SwarByteSum(_data, _dataLength) : err_ScalarByteSum(_data, _dataLength);
+};
+#endif
+
+
+#if ERR_HW_SIMD
+/**
+ * @brief Checksum kernel ERR_KERNEL_SIMD (byte loop below 32 bytes)
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Sum of all bytes modulo 2^32
+ */
+static uint32_t err_SumSimd(const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    *_ran = (_dataLength >= 32) ? ERR_KERNEL_SIMD : ERR_KERNEL_SCALAR;
+
+    return (_dataLength >= 32) ? (uint32_t) err_SimdByteSum(_data, _dataLength) : err_ScalarByteSum(_data, _dataLength);
+};
+
+  #if defined(__x86_64__)
+/**
+ * @brief Checksum kernel ERR_KERNEL_AVX2 (byte loop below 32 bytes)
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Sum of all bytes modulo 2^32
+ */
+static uint32_t err_SumAvx2(const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    *_ran = (_dataLength >= 32) ? ERR_KERNEL_AVX2 : ERR_KERNEL_SCALAR;
+
+    return (_dataLength >= 32) ? (uint32_t) err_Avx2ByteSum(_data, _dataLength) : err_ScalarByteSum(_data, _dataLength);
+};
+  #endif
+#endif
+
+
+/**
+ * @brief Gets the checksum kernel of a kernel id
+ * @param _kernel Kernel id (ERR_KERNEL_SCALAR, _SWAR, _SIMD or _AVX2)
+ * @param _found Set to false when the build or CPU lacks the kernel
+ * @return errSumKernel_T Kernel function, NULL for the byte loop of each width
+ */
+static errSumKernel_T err_SumFind(errKernel_T _kernel, bool *_found)
+{
+    *_found = true;
+
+    if(_kernel == ERR_KERNEL_SCALAR)
+    {
+        return NULL;
+    };
+#if ERR_SUM_SWAR
+    if(_kernel == ERR_KERNEL_SWAR)
+    {
+        return err_SumSwar;
+    };
+#endif
+#if ERR_HW_SIMD
+    if(_kernel == ERR_KERNEL_SIMD)
+    {
+        return err_SumSimd;
+    };
+  #if defined(__x86_64__)
+    if((_kernel == ERR_KERNEL_AVX2) && (err_CpuDetect() & ERR_CPU_AVX2))
+    {
+        return err_SumAvx2;
+    };
+  #endif
+#endif
+
+    *_found = false;
+    return NULL;
+};
+
+
+#if ERR_SUM_SWAR || ERR_HW_SIMD
+
+static uint32_t err_SumResolve(const uint8_t *_data, size_t _dataLength, errKernel_T *_ran);
+
+static errSumKernel_T err_SumKernel = err_SumResolve;   ///< Active checksum kernel, NULL for the byte loop
+
+/**
+ * @brief First checksum call: selects the default kernel, then runs it
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Sum of all bytes modulo 2^32
+ */
+static uint32_t err_SumResolve(const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    errSumKernel_T _kernel = NULL;
+
+    err_KernelSet(ERR_DISPATCH_SUM, ERR_KERNEL_AUTO);
+    _kernel = ERR_KERNEL_LOAD(err_SumKernel);
+    *_ran = ERR_KERNEL_SCALAR;
+
+    return (_kernel != NULL) ? _kernel(_data, _dataLength, _ran) : err_ScalarByteSum(_data, _dataLength);
+};
+
+#else
+
+static errSumKernel_T err_SumKernel = NULL;             ///< Active checksum kernel, NULL for the byte loop
+
+#endif
+
+
+/**
+ * @brief Calculates 8-bit checksum for given data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated checksum value
+ * 
+ * @note This is a simple additive checksum that may not detect all errors
+ *       but is computationally inexpensive.
+ */
+uint8_t checkSum8_Calc(uint8_t *_data, uint16_t _dataLength)
+{
+    return checkSum8_CalcLarge(_data, _dataLength);
+};
+
+
+/**
+ * @brief Calculates 8-bit checksum for a buffer of any size
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint8_t Calculated checksum value
+ */
+uint8_t checkSum8_CalcLarge(uint8_t *_data, size_t _dataLength)
+{
+    uint8_t _Sum = 0x00;
+    size_t _index = 0x00;
+    errSumKernel_T _kernel = ERR_KERNEL_LOAD(err_SumKernel);
+    errKernel_T _ran = ERR_KERNEL_SCALAR;
+    ERR_STATS_BEGIN(ERR_ALGO_CHECKSUM8, _dataLength);
+
+    if(_kernel != NULL)
+    {
+        _Sum = (uint8_t) _kernel(_data, _dataLength, &_ran);
+        return (uint8_t) ERR_STATS_END(ERR_ALGO_CHECKSUM8, _ran, _Sum);
+    };
+
+    for(_index = 0; _index < _dataLength; _index++)
+    {
+        _Sum += _data[_index];
+    };
+
+    return (uint8_t) ERR_STATS_END(ERR_ALGO_CHECKSUM8, ERR_KERNEL_SCALAR, _Sum);
+};
+
+
+/**
+ * @brief Calculates 16-bit checksum for given data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated checksum value
+ * 
+ * @note Provides better error detection than 8-bit checksum
+ *       while maintaining simplicity.
+ */
+uint16_t checkSum16_Calc(uint8_t *_data, uint16_t _dataLength)
+{
+    return checkSum16_CalcLarge(_data, _dataLength);
+};
+
+
+/**
+ * @brief Calculates 16-bit checksum for a buffer of any size
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint16_t Calculated checksum value
+ */
+uint16_t checkSum16_CalcLarge(uint8_t *_data, size_t _dataLength)
+{
+    uint16_t _Sum = 0x00;
+    size_t _index = 0x00;
+    errSumKernel_T _kernel = ERR_KERNEL_LOAD(err_SumKernel);
+    errKernel_T _ran = ERR_KERNEL_SCALAR;
+    ERR_STATS_BEGIN(ERR_ALGO_CHECKSUM16, _dataLength);
+
+    if(_kernel != NULL)
+    {
+        _Sum = (uint16_t) _kernel(_data, _dataLength, &_ran);
+        return (uint16_t) ERR_STATS_END(ERR_ALGO_CHECKSUM16, _ran, _Sum);
+    };
+
+    for(_index = 0; _index < _dataLength; _index++)
+    {
+        _Sum += _data[_index];
+    };
+
+    return (uint16_t) ERR_STATS_END(ERR_ALGO_CHECKSUM16, ERR_KERNEL_SCALAR, _Sum);
+};
+
+
+/**
+ * @brief Calculates 32-bit checksum for given data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated checksum value
+ * 
+ * @note Provides the highest level of error detection among
+ *       the simple checksum implementations.
+ */
+uint32_t checkSum32_Calc(uint8_t *_data, uint16_t _dataLength)
+{
+    return checkSum32_CalcLarge(_data, _dataLength);
+};
+
+
+/**
+ * @brief Calculates 32-bit checksum for a buffer of any size
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint32_t Calculated checksum value
+ */
+uint32_t checkSum32_CalcLarge(uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Sum = 0x00;
+    size_t _index = 0x00;
+    errSumKernel_T _kernel = ERR_KERNEL_LOAD(err_SumKernel);
+    errKernel_T _ran = ERR_KERNEL_SCALAR;
+    ERR_STATS_BEGIN(ERR_ALGO_CHECKSUM32, _dataLength);
+
+    if(_kernel != NULL)
+    {
+        _Sum = (uint32_t) _kernel(_data, _dataLength, &_ran);
+        return (uint32_t) ERR_STATS_END(ERR_ALGO_CHECKSUM32, _ran, _Sum);
+    };
+
+    for(_index = 0; _index < _dataLength; _index++)
+    {
+        _Sum += _data[_index];
+    };
+
+    return (uint32_t) ERR_STATS_END(ERR_ALGO_CHECKSUM32, ERR_KERNEL_SCALAR, _Sum);
+};
+
+
+/**
+ * @brief Advances a Fletcher-16 sum pair over a buffer
+ * @param _Sum1 Running byte sum
+ * @param _Sum2 Running sum of _Sum1
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * 
+ * @note On 16-bit int targets (AVR) the sums stay in 16-bit registers and
+ *       are folded ((s & 0xFF) + (s >> 8), congruent mod 255) every 20 bytes,
+ *       so no division is needed; the sums are then only partially reduced
+ *       (at most 510). Elsewhere 32-bit sums are reduced with % 255 every
+ *       ERR_SUM_BLOCK bytes and long runs use the SIMD kernel on hosts.
+ */
+static void fletcher16_Sum(uint16_t *_Sum1, uint16_t *_Sum2, const uint8_t *_data, size_t _dataLength)
+{
+#if (UINT_MAX == 0xFFFFU)
+    uint16_t _s1 = *_Sum1;
+    uint16_t _s2 = *_Sum2;
+    uint8_t _block = 0x00;
+
+    while(_dataLength > 0)
+    {
+        _block = (_dataLength > ERR_FLETCHER16_BLOCK) ? ERR_FLETCHER16_BLOCK : (uint8_t)_dataLength;
+        _dataLength -= _block;
+
+        do
+        {
+            _s1 += *_data++;
+            _s2 += _s1;
+        } while(--_block);
+
+        _s1 = (_s1 & 0xFF) + (_s1 >> 8);
+        _s2 = (_s2 & 0xFF) + (_s2 >> 8);
+    };
+#else
+    uint32_t _s1 = *_Sum1;
+    uint32_t _s2 = *_Sum2;
+    size_t _block = 0x00;
+
+    while(_dataLength > 0)
+    {
+        _block = (_dataLength > ERR_SUM_BLOCK) ? ERR_SUM_BLOCK : _dataLength;
+        _dataLength -= _block;
+
+  #if ERR_HW_SIMD
+        if(_block >= 32)
+        {
+            err_SimdFletcherSum(_data, _block >> 5, &_s1, &_s2);
+            _data += _block & ~(size_t)31;
+            _block &= 31;
+        };
+  #endif
+
+        for(; _block > 0; _block--)
+        {
+            _s1 += *_data++;
+            _s2 += _s1;
+        };
+
+        _s1 %= 255;
+        _s2 %= 255;
+    };
+#endif
+
+    *_Sum1 = (uint16_t)_s1;
+    *_Sum2 = (uint16_t)_s2;
+};
+
+
+/**
+ * @brief Fully reduces a partially reduced Fletcher-16 sum
+ * @param _Sum Sum congruent to the result, at most 510
+ * @return uint8_t _Sum mod 255
+ */
+static uint8_t fletcher16_Reduce(uint16_t _Sum)
+{
+    _Sum = (_Sum & 0xFF) + (_Sum >> 8);
+
+    return (uint8_t)((_Sum >= 255) ? (_Sum - 255) : _Sum);
+};
+
+
+/**
+ * @brief Calculates Fletcher-16 checksum
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Fletcher-16 value (Sum2 << 8 | Sum1)
+ * 
+ * @note Two sums modulo 255: Sum1 of the bytes and Sum2 of the running Sum1,
+ *       so unlike checkSum8/16 it detects reordered bytes and most bursts
+ *       at the cost of two additions per byte, which makes it a good fit
+ *       for 8-bit cores that cannot afford a CRC.
+ */
+uint16_t Fletcher16_Calc(uint8_t *_data, size_t _dataLength)
+{
+    hfletcher16Ctx_T _ctx;
+
+    Fletcher16_Init(&_ctx);
+    Fletcher16_Update(&_ctx, _data, _dataLength);
+
+    return Fletcher16_Final(&_ctx);
+};
+
+
+/**
+ * @brief Starts a Fletcher-16 calculation
+ * @param hctx Pointer to Fletcher-16 streaming context
+ */
+void Fletcher16_Init(hfletcher16Ctx_T *hctx)
+{
+    hctx->Sum1 = 0x00;
+    hctx->Sum2 = 0x00;
+};
+
+
+/**
+ * @brief Feeds the next fragment into a Fletcher-16 calculation
+ * @param hctx Pointer to Fletcher-16 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void Fletcher16_Update(hfletcher16Ctx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_FLETCHER16, _dataLength);
+
+    fletcher16_Sum(&hctx->Sum1, &hctx->Sum2, _data, _dataLength);
+
+    ERR_STATS_DONE(ERR_ALGO_FLETCHER16, ERR_STATS_SUM_KERNEL(32));
+};
+
+
+/**
+ * @brief Returns the Fletcher-16 of all fragments fed so far
+ * @param hctx Pointer to Fletcher-16 streaming context
+ * @return uint16_t Fletcher-16 value (Sum2 << 8 | Sum1)
+ * 
+ * @note The context is not modified, so more fragments may still be added.
+ */
+uint16_t Fletcher16_Final(hfletcher16Ctx_T *hctx)
+{
+    return ((uint16_t)fletcher16_Reduce(hctx->Sum2) << 8) | fletcher16_Reduce(hctx->Sum1);
+};
+
+
+/**
+ * @brief Advances a Fletcher-32 sum pair over whole 16-bit words
+ * @param _Sum1 Running word sum (mod 65535)
+ * @param _Sum2 Running sum of _Sum1 (mod 65535)
+ * @param _data Pointer to input data array (16-bit little endian words)
+ * @param _words Number of words
+ */
+static void fletcher32_Sum(uint32_t *_Sum1, uint32_t *_Sum2, const uint8_t *_data, size_t _words)
+{
+    uint32_t _s1 = *_Sum1;
+    uint32_t _s2 = *_Sum2;
+    size_t _block = 0x00;
+
+    while(_words > 0)
+    {
+#if ERR_HW_SIMD
+        if(_words >= 8)
+        {
+            _block = _words >> 3;
+            if(_block > ERR_FLETCHER32_STEPS)
+            {
+                _block = ERR_FLETCHER32_STEPS;
+            };
+
+            err_SimdFletcher32Sum(_data, _block, &_s1, &_s2);
+            _data += _block * 16;
+            _words -= _block * 8;
+            continue;
+        };
+#endif
+
+        _block = (_words > ERR_FLETCHER32_WORDS) ? ERR_FLETCHER32_WORDS : _words;
+        _words -= _block;
+
+        for(; _block > 0; _block--, _data += 2)
+        {
+            _s1 += (uint32_t)_data[0] | ((uint32_t)_data[1] << 8);
+            _s2 += _s1;
+        };
+
+        _s1 %= 65535;
+        _s2 %= 65535;
+    };
+
+    *_Sum1 = _s1;
+    *_Sum2 = _s2;
+};
+
+
+/**
+ * @brief Calculates Fletcher-32 checksum
+ * @param _data Pointer to input data array (16-bit little endian words)
+ * @param _dataLength Length of data in bytes (an odd last byte is padded with 0x00)
+ * @return uint32_t Fletcher-32 value (Sum2 << 16 | Sum1)
+ * 
+ * @note Fletcher-16 on 16-bit words with sums modulo 65535. Words are
+ *       formed little endian, as in the usual uint16_t array implementation
+ *       on x86/ARM, independently of the target byte order.
+ */
+uint32_t Fletcher32_Calc(uint8_t *_data, size_t _dataLength)
+{
+    hfletcher32Ctx_T _ctx;
+
+    Fletcher32_Init(&_ctx);
+    Fletcher32_Update(&_ctx, _data, _dataLength);
+
+    return Fletcher32_Final(&_ctx);
+};
+
+
+/**
+ * @brief Starts a Fletcher-32 calculation
+ * @param hctx Pointer to Fletcher-32 streaming context
+ */
+void Fletcher32_Init(hfletcher32Ctx_T *hctx)
+{
+    hctx->Sum1 = 0x00;
+    hctx->Sum2 = 0x00;
+    hctx->Byte = 0x00;
+    hctx->Odd = false;
+};
+
+
+/**
+ * @brief Feeds the next fragment into a Fletcher-32 calculation
+ * @param hctx Pointer to Fletcher-32 streaming context
+ * @param _data Pointer to fragment data (any length, odd lengths allowed)
+ * @param _dataLength Length of fragment in bytes
+ * 
+ * @note A word split by a fragment boundary is completed with the first
+ *       byte of the next fragment.
+ */
+void Fletcher32_Update(hfletcher32Ctx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    uint8_t _word[2];
+    ERR_STATS_BEGIN(ERR_ALGO_FLETCHER32, _dataLength);
+
+    if(_dataLength == 0)
+    {
+        ERR_STATS_DONE(ERR_ALGO_FLETCHER32, ERR_STATS_SUM_KERNEL(16));
+        return;
+    };
+
+    if(hctx->Odd)
+    {
+        _word[0] = hctx->Byte;
+        _word[1] = *_data++;
+        _dataLength--;
+        hctx->Odd = false;
+        fletcher32_Sum(&hctx->Sum1, &hctx->Sum2, _word, 1);
+    };
+
+    fletcher32_Sum(&hctx->Sum1, &hctx->Sum2, _data, _dataLength >> 1);
+
+    if(_dataLength & 0x01)
+    {
+        hctx->Byte = _data[_dataLength - 1];
+        hctx->Odd = true;
+    };
+
+    ERR_STATS_DONE(ERR_ALGO_FLETCHER32, ERR_STATS_SUM_KERNEL(16));
+};
+
+
+/**
+ * @brief Returns the Fletcher-32 of all fragments fed so far
+ * @param hctx Pointer to Fletcher-32 streaming context
+ * @return uint32_t Fletcher-32 value (Sum2 << 16 | Sum1)
+ * 
+ * @note A pending odd byte is added as a word padded with 0x00; the context
+ *       is not modified.
+ */
+uint32_t Fletcher32_Final(hfletcher32Ctx_T *hctx)
+{
+    uint32_t _s1 = hctx->Sum1;
+    uint32_t _s2 = hctx->Sum2;
+
+    if(hctx->Odd)
+    {
+        _s1 = (_s1 + hctx->Byte) % 65535;
+        _s2 = (_s2 + _s1) % 65535;
+    };
+
+    return (_s2 << 16) | _s1;
+};
+
+
+/**
+ * @brief Calculates Adler-32 checksum (RFC 1950, zlib)
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Adler-32 value (Sum2 << 16 | Sum1), same as zlib adler32()
+ * 
+ * @note Fletcher sums over bytes modulo the prime 65521, with Sum1 starting
+ *       at 1 so leading zero bytes change the result.
+ */
+uint32_t Adler32_Calc(uint8_t *_data, size_t _dataLength)
+{
+    hadler32Ctx_T _ctx;
+
+    Adler32_Init(&_ctx);
+    Adler32_Update(&_ctx, _data, _dataLength);
+
+    return Adler32_Final(&_ctx);
+};
+
+
+/**
+ * @brief Starts an Adler-32 calculation
+ * @param hctx Pointer to Adler-32 streaming context
+ */
+void Adler32_Init(hadler32Ctx_T *hctx)
+{
+    hctx->Sum1 = 0x01;
+    hctx->Sum2 = 0x00;
+};
+
+
+/**
+ * @brief Feeds the next fragment into an Adler-32 calculation
+ * @param hctx Pointer to Adler-32 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ * 
+ * @note The sums are reduced every ERR_SUM_BLOCK bytes; long runs use the
+ *       SIMD kernel on hosts.
+ */
+void Adler32_Update(hadler32Ctx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _s1 = hctx->Sum1;
+    uint32_t _s2 = hctx->Sum2;
+    size_t _block = 0x00;
+    ERR_STATS_BEGIN(ERR_ALGO_ADLER32, _dataLength);
+
+    while(_dataLength > 0)
+    {
+        _block = (_dataLength > ERR_SUM_BLOCK) ? ERR_SUM_BLOCK : _dataLength;
+        _dataLength -= _block;
+
+#if ERR_HW_SIMD
+        if(_block >= 32)
+        {
+            err_SimdFletcherSum(_data, _block >> 5, &_s1, &_s2);
+            _data += _block & ~(size_t)31;
+            _block &= 31;
+        };
+#endif
+
+        for(; _block > 0; _block--)
+        {
+            _s1 += *_data++;
+            _s2 += _s1;
+        };
+
+        _s1 %= 65521;
+        _s2 %= 65521;
+    };
+
+    hctx->Sum1 = _s1;
+    hctx->Sum2 = _s2;
+
+    ERR_STATS_DONE(ERR_ALGO_ADLER32, ERR_STATS_SUM_KERNEL(32));
+};
+
+
+/**
+ * @brief Returns the Adler-32 of all fragments fed so far
+ * @param hctx Pointer to Adler-32 streaming context
+ * @return uint32_t Adler-32 value (Sum2 << 16 | Sum1)
+ */
+uint32_t Adler32_Final(hadler32Ctx_T *hctx)
+{
+    return (hctx->Sum2 << 16) | hctx->Sum1;
+};
+
+
+/**
+ * @brief Folds a one's-complement sum to 16 bits
+ * @param _Sum Sum of 16-bit words
+ * @return uint16_t End-around-carry folded sum
+ */
+static uint16_t inet_Fold(uint32_t _Sum)
+{
+    _Sum = (_Sum & 0xFFFF) + (_Sum >> 16);
+    _Sum = (_Sum & 0xFFFF) + (_Sum >> 16);
+
+    return (uint16_t)_Sum;
+};
+
+
+/**
+ * @brief One's-complement sum of a buffer of 16-bit big endian words
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (an odd last byte is padded with 0x00)
+ * @return uint16_t Folded one's-complement sum
+ * 
+ * @note The one's-complement sum does not depend on the byte order (RFC 1071
+ *       section 2(B)): on hosts the SIMD kernel adds little endian words
+ *       and the folded result is byte swapped.
+ */
+static uint16_t inet_Sum(const uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Sum = 0x00;
+    size_t _block = 0x00;
+#if ERR_HW_SIMD
+    uint64_t _Wide = 0x00;
+
+    if(_dataLength >= 16)
+    {
+        _Wide = err_SimdWordSum(_data, _dataLength >> 4);
+        _Wide = (_Wide & 0xFFFFFFFFULL) + (_Wide >> 32);
+        _Wide = (_Wide & 0xFFFFFFFFULL) + (_Wide >> 32);
+        _Sum = inet_Fold((uint32_t)_Wide);
+        _Sum = ((_Sum & 0xFF) << 8) | (_Sum >> 8);
+
+        _data += _dataLength & ~(size_t)15;
+        _dataLength &= 15;
+    };
+#endif
+
+    while(_dataLength >= 2)
+    {
+        _block = _dataLength >> 1;
+        if(_block > ERR_INET_WORDS)
+        {
+            _block = ERR_INET_WORDS;
+        };
+        _dataLength -= _block << 1;
+
+        for(; _block > 0; _block--, _data += 2)
+        {
+            _Sum += ((uint32_t)_data[0] << 8) | _data[1];
+        };
+
+        _Sum = inet_Fold(_Sum);
+    };
+
+    if(_dataLength > 0)
+    {
+        _Sum += (uint32_t)_data[0] << 8;
+    };
+
+    return inet_Fold(_Sum);
+};
+
+
+/**
+ * @brief Calculates the Internet checksum (RFC 1071, IPv4/UDP/TCP/ICMP)
+ * @param _data Pointer to input data array (16-bit big endian words)
+ * @param _dataLength Length of data in bytes (an odd last byte is padded with 0x00)
+ * @return uint16_t One's complement of the one's-complement sum, to be stored MSB first
+ * 
+ * @note Calculated over a header whose checksum field holds the correct
+ *       value, the result is 0x0000.
+ */
+uint16_t checkSumInet_Calc(uint8_t *_data, size_t _dataLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_INET, _dataLength);
+
+    return (uint16_t) ERR_STATS_END(ERR_ALGO_INET, ERR_STATS_SUM_KERNEL(16), (uint16_t)~inet_Sum(_data, _dataLength));
+};
+
+
+/**
+ * @brief Starts an Internet checksum calculation
+ * @param hctx Pointer to Internet checksum streaming context
+ */
+void checkSumInet_Init(hcheckSumInetCtx_T *hctx)
+{
+    hctx->Sum = 0x00;
+    hctx->Odd = false;
+};
+
+
+/**
+ * @brief Feeds the next fragment into an Internet checksum calculation
+ * @param hctx Pointer to Internet checksum streaming context
+ * @param _data Pointer to fragment data (any length, odd lengths allowed)
+ * @param _dataLength Length of fragment in bytes
+ * 
+ * @note A fragment starting at an odd offset is summed as if it started a
+ *       word and its sum is byte swapped (RFC 1071 section 2(B)), so no
+ *       byte has to be carried between fragments.
+ */
+void checkSumInet_Update(hcheckSumInetCtx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    uint16_t _Sum = 0x00;
+    ERR_STATS_BEGIN(ERR_ALGO_INET, _dataLength);
+
+    _Sum = inet_Sum(_data, _dataLength);
+
+    if(hctx->Odd)
+    {
+        _Sum = (uint16_t)((_Sum << 8) | (_Sum >> 8));
+    };
+
+    hctx->Sum = inet_Fold(hctx->Sum + _Sum);
+
+    if(_dataLength & 0x01)
+    {
+        hctx->Odd = !hctx->Odd;
+    };
+
+    ERR_STATS_DONE(ERR_ALGO_INET, ERR_STATS_SUM_KERNEL(16));
+};
+
+
+/**
+ * @brief Returns the Internet checksum of all fragments fed so far
+ * @param hctx Pointer to Internet checksum streaming context
+ * @return uint16_t Internet checksum, to be stored MSB first
+ */
+uint16_t checkSumInet_Final(hcheckSumInetCtx_T *hctx)
+{
+    return (uint16_t)~inet_Fold(hctx->Sum);
+};
+
+
+/**
+ * @brief Reflects the bits of input data
+ * @param _data Input data to be reflected
+ * @param _dataBits Number of bits to reflect (1 to 32; 0 is not allowed)
+ * @return uint32_t Bit-reflected output
+ * 
+ * @note Used internally for CRC calculations when input/output
+ *       reflection is required by the CRC standard.
+ *       Swaps halves, bytes, nibbles, bit pairs and single bits of the
+ *       whole word and then drops the unused low bits, so the cost is
+ *       a fixed handful of operations instead of one per bit.
+ */
+uint32_t bitReflected(uint32_t _data, uint8_t _dataBits)
+{
+    _data = (_data >> 16) | (_data << 16);
+    _data = ((_data >> 8) & 0x00FF00FFUL) | ((_data & 0x00FF00FFUL) << 8);
+    _data = ((_data >> 4) & 0x0F0F0F0FUL) | ((_data & 0x0F0F0F0FUL) << 4);
+    _data = ((_data >> 2) & 0x33333333UL) | ((_data & 0x33333333UL) << 2);
+    _data = ((_data >> 1) & 0x55555555UL) | ((_data & 0x55555555UL) << 1);
+
+    return _data >> (32 - _dataBits);
+};
+
+
+/**
+ * @brief Multiplies two polynomials modulo an MSB-first CRC polynomial
+ * @param _a First factor (degree lower than _width)
+ * @param _b Second factor (degree lower than _width)
+ * @param _Poly CRC polynomial without the implicit x^width term
+ * @param _width CRC width in bits (up to 32)
+ * @return uint32_t _a * _b mod P over GF(2)
+ */
+static uint32_t crc_MulMod(uint32_t _a, uint32_t _b, uint32_t _Poly, uint8_t _width)
+{
+    uint64_t _Rem = 0x00;
+    uint64_t _topBit = ((uint64_t)1) << _width;
+    uint8_t _bitIndex = _width;
+
+    while(_bitIndex > 0)
+    {
+        _bitIndex--;
+        _Rem <<= 1;
+        if(_Rem & _topBit)
+        {
+            _Rem ^= _topBit | _Poly;
+        };
+        if(bitCheckHigh(_b, _bitIndex))
+        {
+            _Rem ^= _a;
+        };
+    };
+
+    return (uint32_t)_Rem;
+};
+
+
+/**
+ * @brief Calculates x^n mod P for an MSB-first CRC polynomial
+ * @param _n Exponent
+ * @param _Poly CRC polynomial without the implicit x^width term
+ * @param _width CRC width in bits (8 to 32)
+ * @return uint32_t Remainder of degree lower than _width
+ * 
+ * @note Square-and-multiply: about 2*log2(n) calls of crc_MulMod.
+ */
+static uint32_t crc_xPowMod(uint64_t _n, uint32_t _Poly, uint8_t _width)
+{
+    uint32_t _Rem = 0x01;
+    uint32_t _Square = 0x02;
+
+    for(; _n > 0; _n >>= 1)
+    {
+        if(_n & 0x01)
+        {
+            _Rem = crc_MulMod(_Rem, _Square, _Poly, _width);
+        };
+        _Square = crc_MulMod(_Square, _Square, _Poly, _width);
+    };
+
+    return _Rem;
+};
+
+
+/**
+ * @brief Merges the CRCs of two adjacent blocks into the CRC of their concatenation
+ * @param _crcA Final CRC of the first block
+ * @param _crcB Final CRC of the second block
+ * @param _lengthB Length of the second block in bytes
+ * @param _Poly, _Init, _refOut, _xorOut Configuration of both CRCs (MSB-first form)
+ * @param _width CRC width in bits (8, 16 or 32)
+ * @return uint32_t Final CRC of block A followed by block B
+ * 
+ * @note Undoing xorOut/refOut gives the MSB-first registers rA and rB. Feeding
+ *       B into rA multiplies rA by x^(8*lengthB), while rB already holds that
+ *       product for Init, so the merged register is (rA ^ Init) * x^(8*lengthB) ^ rB.
+ *       refIn only changes the bit order inside the input bytes and plays no part.
+ */
+static uint32_t crc_Combine(uint32_t _crcA, uint32_t _crcB, size_t _lengthB, uint32_t _Poly, uint32_t _Init, bool _refOut, uint32_t _xorOut, uint8_t _width)
+{
+    uint32_t _CRC = 0x00;
+
+    if(_refOut)
+    {
+        _crcA = bitReflected(_crcA, _width);
+        _crcB = bitReflected(_crcB, _width);
+    };
+
+    /* xorOut of rB and the xorOut of the merged result cancel out */
+    _CRC = crc_MulMod(_crcA ^ _xorOut ^ _Init, crc_xPowMod(((uint64_t)_lengthB) << 3, _Poly, _width), _Poly, _width);
+    _CRC ^= _crcB;
+
+    if(_refOut)
+    {
+        _CRC = bitReflected(_CRC, _width);
+    };
+
+    return _CRC;
+};
+
+
+/**
+ * @brief Updates a final CRC after a span of the message was rewritten in place
+ * @param _CRC Final CRC of the original message
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @param _tailLength Number of message bytes after the span
+ * @param _Poly, _refIn, _refOut Configuration of the CRC (MSB-first form)
+ * @param _width CRC width in bits (8, 16 or 32)
+ * @return uint32_t Final CRC of the modified message
+ * 
+ * @note CRC linearity: the registers of the two messages differ by the
+ *       register of (old ^ new) with Init = 0, shifted through the tail
+ *       bytes. That difference is the bitwise CRC of the span times
+ *       x^(8*tailLength) mod P; Init and xorOut cancel out, refOut
+ *       reflects it like the CRC itself.
+ */
+static uint32_t crc_Patch(uint32_t _CRC, const uint8_t *_oldData, const uint8_t *_newData, size_t _dataLength, size_t _tailLength, uint32_t _Poly, bool _refIn, bool _refOut, uint8_t _width)
+{
+    uint64_t _Reg = 0x00;
+    uint64_t _topBit = ((uint64_t)1) << _width;
+    uint8_t _byte = 0x00;
+    uint8_t _bitIndex = 0x00;
+    size_t _dataIndex = 0x00;
+
+    for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+    {
+        _byte = _oldData[_dataIndex] ^ _newData[_dataIndex];
+        if(_refIn)
+        {
+            _byte = (uint8_t) bitReflected(_byte, 8);
+        };
+
+        _Reg ^= ((uint64_t)_byte) << (_width - 8);
+        for(_bitIndex = 0; _bitIndex < 8; _bitIndex++)
+        {
+            _Reg <<= 1;
+            if(_Reg & _topBit)
+            {
+                _Reg ^= _topBit | _Poly;
+            };
+        };
+    };
+
+    _Reg = crc_MulMod((uint32_t)_Reg, crc_xPowMod(((uint64_t)_tailLength) << 3, _Poly, _width), _Poly, _width);
+
+    if(_refOut)
+    {
+        _Reg = bitReflected((uint32_t)_Reg, _width);
+    };
+
+    return _CRC ^ (uint32_t)_Reg;
+};
+
+
+#if ERR_HW_CRC
+
+#if defined(__x86_64__)
+  #define ERR_TARGET_CRC __attribute__((target("sse4.2")))
+#elif defined(__clang__)
+  #define ERR_TARGET_CRC __attribute__((target("crc")))
+#else
+  #define ERR_TARGET_CRC __attribute__((target("+crc")))
+#endif
+
+#define ERR_POLY_CRC32   0x04C11DB7UL  ///< CRC-32 (Ethernet) polynomial
+#define ERR_POLY_CRC32C  0x1EDC6F41UL  ///< CRC-32C (Castagnoli) polynomial
+
+
+/**
+ * @brief Updates a reflected CRC-32C register with the CPU CRC instructions
+ * @param _CRC CRC register kept in reflected (LSB-first) order
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Updated CRC register
+ */
+ERR_TARGET_CRC static uint32_t crc32c_HwUpdate(uint32_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    uint64_t _Word = 0x00;
+
+    for(; _dataLength >= 8; _dataLength -= 8, _data += 8)
+    {
+        memcpy(&_Word, _data, 8);
+#if defined(__x86_64__)
+        _CRC = (uint32_t) _mm_crc32_u64(_CRC, _Word);
+#else
+        _CRC = __crc32cd(_CRC, _Word);
+#endif
+    };
+
+    for(; _dataLength > 0; _dataLength--, _data++)
+    {
+#if defined(__x86_64__)
+        _CRC = _mm_crc32_u8(_CRC, *_data);
+#else
+        _CRC = __crc32cb(_CRC, *_data);
+#endif
+    };
+
+    return _CRC;
+};
+
+
+#if defined(__aarch64__)
+/**
+ * @brief Updates a reflected CRC-32 register with the ARMv8 CRC instructions
+ * @param _CRC CRC register kept in reflected (LSB-first) order
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Updated CRC register
+ */
+ERR_TARGET_CRC static uint32_t crc32_HwUpdate(uint32_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    uint64_t _Word = 0x00;
+
+    for(; _dataLength >= 8; _dataLength -= 8, _data += 8)
+    {
+        memcpy(&_Word, _data, 8);
+        _CRC = __crc32d(_CRC, _Word);
+    };
+
+    for(; _dataLength > 0; _dataLength--, _data++)
+    {
+        _CRC = __crc32b(_CRC, *_data);
+    };
+
+    return _CRC;
+};
+#endif
+
+
+/**
+ * @brief Checks whether a reflected CRC32 polynomial is computed by the CPU
+ * @param _Poly CRC32 polynomial of a configuration with refIn set
+ * @return bool true when crc32_HwCalc will take the polynomial on this CPU
+ */
+static bool crc32_HwUsable(uint32_t _Poly)
+{
+    if(!(err_CpuDetect() & ERR_CPU_CRC))
+    {
+        return false;
+    };
+
+#if defined(__aarch64__)
+    return (_Poly == ERR_POLY_CRC32C) || (_Poly == ERR_POLY_CRC32);
+#else
+    return (_Poly == ERR_POLY_CRC32C);
+#endif
+};
+
+
+/**
+ * @brief Runs a reflected CRC32 register through the hardware backend if possible
+ * @param _Poly CRC32 polynomial of a configuration with refIn set
+ * @param _CRC Pointer to CRC register kept in reflected (LSB-first) order
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return bool true when the register was updated by hardware, false when
+ *         the polynomial or the CPU is not supported
+ */
+static bool crc32_HwCalc(uint32_t _Poly, uint32_t *_CRC, const uint8_t *_data, size_t _dataLength)
+{
+    if(!(err_CpuDetect() & ERR_CPU_CRC))
+    {
+        return false;
+    };
+
+    if(_Poly == ERR_POLY_CRC32C)
+    {
+        *_CRC = crc32c_HwUpdate(*_CRC, _data, _dataLength);
+        return true;
+    };
+
+#if defined(__aarch64__)
+    if(_Poly == ERR_POLY_CRC32)
+    {
+        *_CRC = crc32_HwUpdate(*_CRC, _data, _dataLength);
+        return true;
+    };
+#endif
+
+    return false;
+};
+
+#endif /* ERR_HW_CRC */
+
+
+#if ERR_HW_CLMUL
+
+#if defined(__x86_64__)
+  #define ERR_TARGET_CLMUL __attribute__((target("pclmul,ssse3")))
+#elif defined(__clang__)
+  #define ERR_TARGET_CLMUL __attribute__((target("aes")))
+#else
+  #define ERR_TARGET_CLMUL __attribute__((target("+crypto")))
+#endif
+
+/**
+ * @brief Computes the carry-less multiply fold constants of a CRC configuration
+ * @param _fold Pointer to the 4 constants to fill
+ * @param _Poly CRC polynomial (MSB-first form, as in the configuration)
+ * @param _width CRC width in bits (16 or 32)
+ * @param _refIn true for the reflected (LSB-first) register layout
+ * 
+ * @note A 128-bit block A = H*x^64 + L that is followed by E more message bits
+ *       is congruent to H*(x^(E+64) mod P) + L*(x^E mod P), so two carry-less
+ *       multiplies replace it by a value that can be XORed into the block E bits
+ *       further on. _fold[0..1] serve E = 512 (four parallel streams) and
+ *       _fold[2..3] serve E = 128; the even entry multiplies the low 64-bit lane.
+ *       For reflected registers the lanes swap, constants are bit-reflected and
+ *       pre-shifted, and exponents absorb the (64 - width) bit offset of the
+ *       reflected product.
+ */
+static void crc_ClmulConstants(uint64_t *_fold, uint32_t _Poly, uint8_t _width, bool _refIn)
+{
+    if(_refIn)
+    {
+        _fold[0] = ((uint64_t) bitReflected(crc_xPowMod(512 + _width, _Poly, _width), _width)) << 1;
+        _fold[1] = ((uint64_t) bitReflected(crc_xPowMod(448 + _width, _Poly, _width), _width)) << 1;
+        _fold[2] = ((uint64_t) bitReflected(crc_xPowMod(128 + _width, _Poly, _width), _width)) << 1;
+        _fold[3] = ((uint64_t) bitReflected(crc_xPowMod(64 + _width, _Poly, _width), _width)) << 1;
+    }
+    else
+    {
+        _fold[0] = crc_xPowMod(512, _Poly, _width);
+        _fold[1] = crc_xPowMod(576, _Poly, _width);
+        _fold[2] = crc_xPowMod(128, _Poly, _width);
+        _fold[3] = crc_xPowMod(192, _Poly, _width);
+    };
+};
+
+
+#if defined(__x86_64__)
+typedef __m128i crcVec_T;
+
+#define ERR_VEC_LOAD(p)         _mm_loadu_si128((const __m128i *)(p))
+#define ERR_VEC_STORE(p, v)     _mm_storeu_si128((__m128i *)(p), (v))
+#define ERR_VEC_XOR(a, b)       _mm_xor_si128((a), (b))
+#define ERR_VEC_SET(hi, lo)     _mm_set_epi64x((long long)(hi), (long long)(lo))
+#define ERR_VEC_BSWAP(v)        _mm_shuffle_epi8((v), _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))
+#define ERR_VEC_FOLD(x, k)      _mm_xor_si128(_mm_clmulepi64_si128((x), (k), 0x00), _mm_clmulepi64_si128((x), (k), 0x11))
+#else
+typedef uint64x2_t crcVec_T;
+
+#define ERR_VEC_LOAD(p)         vreinterpretq_u64_u8(vld1q_u8((const uint8_t *)(p)))
+#define ERR_VEC_STORE(p, v)     vst1q_u8((uint8_t *)(p), vreinterpretq_u8_u64(v))
+#define ERR_VEC_XOR(a, b)       veorq_u64((a), (b))
+#define ERR_VEC_SET(hi, lo)     vcombine_u64(vcreate_u64((uint64_t)(lo)), vcreate_u64((uint64_t)(hi)))
+#define ERR_VEC_BSWAP(v)        vreinterpretq_u64_u8(vrev64q_u8(vreinterpretq_u8_u64(vextq_u64((v), (v), 1))))
+#define ERR_VEC_FOLD(x, k)      veorq_u64(                                                               \
+                                    vreinterpretq_u64_p128(vmull_p64(                                    \
+                                        (poly64_t)vgetq_lane_u64((x), 0), (poly64_t)vgetq_lane_u64((k), 0))), \
+                                    vreinterpretq_u64_p128(vmull_high_p64(                               \
+                                        vreinterpretq_p64_u64(x), vreinterpretq_p64_u64(k))))
+#endif
+
+
+/**
+ * @brief Folds a buffer into a 16-byte remainder with carry-less multiplication
+ * @param _fold Pointer to the fold constants from crc_ClmulConstants
+ * @param _refIn true for the reflected (LSB-first) register layout
+ * @param _width CRC width in bits (16 or 32)
+ * @param _CRC CRC register before the buffer
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (at least 64)
+ * @param _Rem Output: 16 bytes whose CRC with a zero register equals the
+ *             register after the consumed bytes
+ * @return size_t Number of bytes consumed (a multiple of 16)
+ * 
+ * @note The register is XORed into the first message bits, four streams are
+ *       folded 64 bytes per iteration, merged into one and then folded 16
+ *       bytes at a time. Blocks are byte-swapped for MSB-first registers so
+ *       the first message byte lands in the most significant lane.
+ */
+ERR_TARGET_CLMUL static size_t crc_ClmulFold(const uint64_t *_fold, bool _refIn, uint8_t _width, uint32_t _CRC,
+                                             const uint8_t *_data, size_t _dataLength, uint8_t *_Rem)
+{
+    crcVec_T _x0, _x1, _x2, _x3;
+    crcVec_T _k512 = ERR_VEC_SET(_fold[1], _fold[0]);
+    crcVec_T _k128 = ERR_VEC_SET(_fold[3], _fold[2]);
+    crcVec_T _init;
+    size_t _dataIndex = 64;
+
+    if(_refIn)
+    {
+        _init = ERR_VEC_SET(0, _CRC);
+        _x0 = ERR_VEC_LOAD(_data);
+        _x1 = ERR_VEC_LOAD(_data + 16);
+        _x2 = ERR_VEC_LOAD(_data + 32);
+        _x3 = ERR_VEC_LOAD(_data + 48);
+    }
+    else
+    {
+        _init = ERR_VEC_SET(((uint64_t)_CRC) << (64 - _width), 0);
+        _x0 = ERR_VEC_BSWAP(ERR_VEC_LOAD(_data));
+        _x1 = ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + 16));
+        _x2 = ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + 32));
+        _x3 = ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + 48));
+    };
+    _x0 = ERR_VEC_XOR(_x0, _init);
+
+    for(; (_dataLength - _dataIndex) >= 64; _dataIndex += 64)
+    {
+        if(_refIn)
+        {
+            _x0 = ERR_VEC_XOR(ERR_VEC_FOLD(_x0, _k512), ERR_VEC_LOAD(_data + _dataIndex));
+            _x1 = ERR_VEC_XOR(ERR_VEC_FOLD(_x1, _k512), ERR_VEC_LOAD(_data + _dataIndex + 16));
+            _x2 = ERR_VEC_XOR(ERR_VEC_FOLD(_x2, _k512), ERR_VEC_LOAD(_data + _dataIndex + 32));
+            _x3 = ERR_VEC_XOR(ERR_VEC_FOLD(_x3, _k512), ERR_VEC_LOAD(_data + _dataIndex + 48));
+        }
+        else
+        {
+            _x0 = ERR_VEC_XOR(ERR_VEC_FOLD(_x0, _k512), ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + _dataIndex)));
+            _x1 = ERR_VEC_XOR(ERR_VEC_FOLD(_x1, _k512), ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + _dataIndex + 16)));
+            _x2 = ERR_VEC_XOR(ERR_VEC_FOLD(_x2, _k512), ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + _dataIndex + 32)));
+            _x3 = ERR_VEC_XOR(ERR_VEC_FOLD(_x3, _k512), ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + _dataIndex + 48)));
+        };
+    };
+
+    _x1 = ERR_VEC_XOR(ERR_VEC_FOLD(_x0, _k128), _x1);
+    _x2 = ERR_VEC_XOR(ERR_VEC_FOLD(_x1, _k128), _x2);
+    _x3 = ERR_VEC_XOR(ERR_VEC_FOLD(_x2, _k128), _x3);
+
+    for(; (_dataLength - _dataIndex) >= 16; _dataIndex += 16)
+    {
+        if(_refIn)
+        {
+            _x3 = ERR_VEC_XOR(ERR_VEC_FOLD(_x3, _k128), ERR_VEC_LOAD(_data + _dataIndex));
+        }
+        else
+        {
+            _x3 = ERR_VEC_XOR(ERR_VEC_FOLD(_x3, _k128), ERR_VEC_BSWAP(ERR_VEC_LOAD(_data + _dataIndex)));
+        };
+    };
+
+    if(!_refIn)
+    {
+        _x3 = ERR_VEC_BSWAP(_x3);
+    };
+    ERR_VEC_STORE(_Rem, _x3);
+
+    return _dataIndex;
+};
+
+
+/**
+ * @brief Tells whether the folding kernel should take a buffer
+ * @param _dataLength Length of data in bytes
+ * @return bool true when the buffer is long enough and the CPU supports it
+ */
+static bool crc_ClmulUsable(size_t _dataLength)
+{
+    return (_dataLength >= ERR_CLMUL_MIN_LENGTH) && (err_CpuDetect() & ERR_CPU_CLMUL);
+};
+
+#endif /* ERR_HW_CLMUL */
+
+
+/**
+ * @brief Reflects the low _dataBits bits of a 64-bit value
+ * @param _data Input value
+ * @param _dataBits Number of bits to reflect (1..64)
+ * @return uint64_t Reflected value
+ */
+static uint64_t crc_Reflect64(uint64_t _data, uint8_t _dataBits)
+{
+    _data = (((uint64_t)bitReflected((uint32_t)_data, 32)) << 32) | bitReflected((uint32_t)(_data >> 32), 32);
+
+    return _data >> (64 - _dataBits);
+};
+
+
+/**
+ * @brief Defines the register kernels of the CRC engine for one register type
+ * @details One body serves every CRC width up to the register size, so
+ *          CRC8/16/32 and the generic CRCN engine share the same code:
+ *          - _prefix##_RegStart : register value before the first byte
+ *          - _prefix##_RegFinal : final XOR and output reflection
+ *          - _prefix##_RegBits  : bitwise update
+ *          - _prefix##_RegBuild : 256-entry byte table
+ *          - _prefix##_RegTable : table-driven update
+ *          - _prefix##_RegNibbleBuild : 16-entry nibble table
+ *          - _prefix##_RegNibble : nibble-table update (two lookups per byte)
+ *          Registers are passed right-aligned in the low _width bits, in
+ *          reflected (LSB-first) order when refIn is set. MSB-first kernels
+ *          work on the register shifted up to the top of _type, so widths
+ *          below 8 (CRC-3, CRC-5, ...) need no special case; the byte table
+ *          of MSB-first configurations is stored in that top-aligned form.
+ * @param _prefix Kernel name prefix
+ * @param _type Register type (uint8_t, uint16_t, uint32_t or uint64_t)
+ * @param _bits Number of bits of _type
+ * @param _reflect Bit reflection function for _type
+ */
+#define ERR_CRC_ENGINE(_prefix, _type, _bits, _reflect)                                   \
+static _type _prefix##_RegStart(uint8_t _width, bool _refIn, _type _Init)                \
+{                                                                                        \
+    return _refIn ? (_type)_reflect(_Init, _width) : _Init;                              \
+};                                                                                       \
+                                                                                         \
+static _type _prefix##_RegFinal(uint8_t _width, bool _refIn, bool _refOut, _type _xorOut, _type _Reg) \
+{                                                                                        \
+    if(_refIn)                                                                           \
+    {                                                                                    \
+        if(_refOut)                                                                      \
+        {                                                                                \
+            return (_type)(_Reg ^ _reflect(_xorOut, _width));                            \
+        };                                                                               \
+                                                                                         \
+        return (_type)(_reflect(_Reg, _width) ^ _xorOut);                                \
+    };                                                                                   \
+                                                                                         \
+    _Reg ^= _xorOut;                                                                     \
+                                                                                         \
+    return _refOut ? (_type)_reflect(_Reg, _width) : _Reg;                               \
+};                                                                                       \
+                                                                                         \
+static _type _prefix##_RegBits(_type _Poly, uint8_t _width, bool _refIn, _type _Reg, const uint8_t *_data, size_t _dataLength) \
+{                                                                                        \
+    uint8_t _shift = (uint8_t)((_bits) - _width);                                        \
+    uint8_t _bitIndex = 0x00;                                                            \
+                                                                                         \
+    if(_refIn)                                                                           \
+    {                                                                                    \
+        _Poly = (_type)_reflect(_Poly, _width);                                          \
+                                                                                         \
+        for(; _dataLength > 0; _dataLength--, _data++)                                   \
+        {                                                                                \
+            _Reg ^= *_data;                                                              \
+                                                                                         \
+            for(_bitIndex = 0; _bitIndex < 8; _bitIndex++)                               \
+            {                                                                            \
+                _Reg = bitCheck(_Reg, 0) ? (_type)((_Reg >> 1) ^ _Poly) : (_type)(_Reg >> 1); \
+            };                                                                           \
+        };                                                                               \
+                                                                                         \
+        return _Reg;                                                                     \
+    };                                                                                   \
+                                                                                         \
+    _Poly = (_type)(_Poly << _shift);                                                    \
+    _Reg = (_type)(_Reg << _shift);                                                      \
+                                                                                         \
+    for(; _dataLength > 0; _dataLength--, _data++)                                       \
+    {                                                                                    \
+        _Reg ^= (_type)(((_type)*_data) << ((_bits) - 8));                               \
+                                                                                         \
+        for(_bitIndex = 0; _bitIndex < 8; _bitIndex++)                                   \
+        {                                                                                \
+            _Reg = bitCheckHigh(_Reg, (_bits) - 1) ? (_type)((_Reg << 1) ^ _Poly) : (_type)(_Reg << 1); \
+        };                                                                               \
+    };                                                                                   \
+                                                                                         \
+    return (_type)(_Reg >> _shift);                                                      \
+};                                                                                       \
+                                                                                         \
+static void _prefix##_RegBuild(_type *_table, _type _Poly, uint8_t _width, bool _refIn)   \
+{                                                                                        \
+    uint8_t _shift = _refIn ? 0 : (uint8_t)((_bits) - _width);                           \
+    uint8_t _byte = 0x00;                                                                \
+    uint16_t _tableIndex = 0x00;                                                         \
+                                                                                         \
+    for(_tableIndex = 0; _tableIndex < 256; _tableIndex++)                               \
+    {                                                                                    \
+        _byte = (uint8_t)_tableIndex;                                                    \
+        _table[_tableIndex] = (_type)(_prefix##_RegBits(_Poly, _width, _refIn, 0x00, &_byte, 1) << _shift); \
+    };                                                                                   \
+};                                                                                       \
+                                                                                         \
+static _type _prefix##_RegTable(const _type *_table, uint8_t _width, bool _refIn, _type _Reg, const uint8_t *_data, size_t _dataLength) \
+{                                                                                        \
+    uint8_t _shift = (uint8_t)((_bits) - _width);                                        \
+                                                                                         \
+    if(_refIn)                                                                           \
+    {                                                                                    \
+        for(; _dataLength > 0; _dataLength--, _data++)                                   \
+        {                                                                                \
+            _Reg = (_type)((_Reg >> 8) ^ _table[(uint8_t)(_Reg ^ *_data)]);              \
+        };                                                                               \
+                                                                                         \
+        return _Reg;                                                                     \
+    };                                                                                   \
+                                                                                         \
+    _Reg = (_type)(_Reg << _shift);                                                      \
+                                                                                         \
+    for(; _dataLength > 0; _dataLength--, _data++)                                       \
+    {                                                                                    \
+        _Reg = (_type)((_Reg << 8) ^ _table[(uint8_t)((_Reg >> ((_bits) - 8)) ^ *_data)]); \
+    };                                                                                   \
+                                                                                         \
+    return (_type)(_Reg >> _shift);                                                      \
+};                                                                                       \
+                                                                                         \
+static void _prefix##_RegNibbleBuild(_type *_table, _type _Poly, uint8_t _width, bool _refIn) \
+{                                                                                        \
+    uint8_t _shift = _refIn ? 0 : (uint8_t)((_bits) - _width);                           \
+    uint8_t _byte = 0x00;                                                                \
+    uint8_t _tableIndex = 0x00;                                                          \
+                                                                                         \
+    for(_tableIndex = 0; _tableIndex < 16; _tableIndex++)                                \
+    {                                                                                    \
+        _byte = _refIn ? (uint8_t)(_tableIndex << 4) : _tableIndex;                      \
+        _table[_tableIndex] = (_type)(_prefix##_RegBits(_Poly, _width, _refIn, 0x00, &_byte, 1) << _shift); \
+    };                                                                                   \
+};                                                                                       \
+                                                                                         \
+static _type _prefix##_RegNibble(const _type *_table, uint8_t _width, bool _refIn, _type _Reg, const uint8_t *_data, size_t _dataLength) \
+{                                                                                        \
+    uint8_t _shift = (uint8_t)((_bits) - _width);                                        \
+                                                                                         \
+    if(_refIn)                                                                           \
+    {                                                                                    \
+        for(; _dataLength > 0; _dataLength--, _data++)                                   \
+        {                                                                                \
+            _Reg ^= *_data;                                                              \
+            _Reg = (_type)((_Reg >> 4) ^ _table[_Reg & 0x0F]);                           \
+            _Reg = (_type)((_Reg >> 4) ^ _table[_Reg & 0x0F]);                           \
+        };                                                                               \
+                                                                                         \
+        return _Reg;                                                                     \
+    };                                                                                   \
+                                                                                         \
+    _Reg = (_type)(_Reg << _shift);                                                      \
+                                                                                         \
+    for(; _dataLength > 0; _dataLength--, _data++)                                       \
+    {                                                                                    \
+        _Reg ^= (_type)(((_type)*_data) << ((_bits) - 8));                               \
+        _Reg = (_type)((_Reg << 4) ^ _table[_Reg >> ((_bits) - 4)]);                     \
+        _Reg = (_type)((_Reg << 4) ^ _table[_Reg >> ((_bits) - 4)]);                     \
+    };                                                                                   \
+                                                                                         \
+    return (_type)(_Reg >> _shift);                                                      \
+};
+
+ERR_CRC_ENGINE(crc8, uint8_t, 8, bitReflected)
+ERR_CRC_ENGINE(crc16, uint16_t, 16, bitReflected)
+ERR_CRC_ENGINE(crc32, uint32_t, 32, bitReflected)
+ERR_CRC_ENGINE(crcN, uint64_t, 64, crc_Reflect64)
+
+
+/**
+ * @brief Returns the CRC8 register value before the first data byte
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @return uint8_t Initial CRC register
+ * 
+ * @note Configurations with refIn set keep the register in reflected
+ *       (LSB-first) order, so the Init value is reflected once here.
+ */
+static uint8_t crc8_Start(hcrc8_T *hcrc)
+{
+    return crc8_RegStart(8, hcrc->refIn, hcrc->Init);
+};
+
+
+/**
+ * @brief Returns the CRC16 register value before the first data byte
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @return uint16_t Initial CRC register
+ */
+static uint16_t crc16_Start(hcrc16_T *hcrc)
+{
+    return crc16_RegStart(16, hcrc->refIn, hcrc->Init);
+};
+
+
+/**
+ * @brief Returns the CRC32 register value before the first data byte
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @return uint32_t Initial CRC register
+ */
+static uint32_t crc32_Start(hcrc32_T *hcrc)
+{
+    return crc32_RegStart(32, hcrc->refIn, hcrc->Init);
+};
+
+
+/**
+ * @brief Applies final XOR and output reflection to a CRC8 register
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _CRC CRC register after the last data byte
+ * @return uint8_t Final CRC value
+ * 
+ * @note A reflected register already equals the bit-reflected form of the
+ *       MSB-first register, so for refOut the XOR value is reflected instead
+ *       of the result. This keeps the xorOut-then-reflect order of CRC8_Calc.
+ */
+static uint8_t crc8_Final(hcrc8_T *hcrc, uint8_t _CRC)
+{
+    return crc8_RegFinal(8, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _CRC);
+};
+
+
+/**
+ * @brief Applies final XOR and output reflection to a CRC16 register
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _CRC CRC register after the last data byte
+ * @return uint16_t Final CRC value
+ */
+static uint16_t crc16_Final(hcrc16_T *hcrc, uint16_t _CRC)
+{
+    return crc16_RegFinal(16, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _CRC);
+};
+
+
+/**
+ * @brief Applies final XOR and output reflection to a CRC32 register
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _CRC CRC register after the last data byte
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_Final(hcrc32_T *hcrc, uint32_t _CRC)
+{
+    return crc32_RegFinal(32, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _CRC);
+};
+
+
+/**
+ * @brief Runs a CRC8 register through the data bit by bit
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t CRC register after the data
+ * 
+ * @note refIn configurations shift right with the reflected polynomial,
+ *       which is equivalent to reflecting every input byte and shifting
+ *       left, so no per-byte bitReflected() call is needed.
+ */
+static uint8_t crc8_BitUpdate(hcrc8_T *hcrc, uint8_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    return crc8_RegBits(hcrc->Poly, 8, hcrc->refIn, _CRC, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a CRC16 register through the data bit by bit
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t CRC register after the data
+ */
+static uint16_t crc16_BitUpdate(hcrc16_T *hcrc, uint16_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    return crc16_RegBits(hcrc->Poly, 16, hcrc->refIn, _CRC, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a CRC32 register through the data bit by bit
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t CRC register after the data
+ * 
+ * @note CRC-32C/CRC-32 go to the CRC instructions when ERR_HW_CRC is enabled.
+ */
+static uint32_t crc32_BitUpdate(hcrc32_T *hcrc, uint32_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+#if ERR_HW_CRC
+    if(hcrc->refIn && crc32_HwCalc(hcrc->Poly, &_CRC, _data, _dataLength))
+    {
+        return _CRC;
+    };
+#endif
+
+    return crc32_RegBits(hcrc->Poly, 32, hcrc->refIn, _CRC, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a CRC8 register through the byte table
+ * @param _table Pointer to the 256-entry table
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t CRC register after the data
+ * 
+ * @note For an 8-bit register the MSB-first and reflected table steps
+ *       are the same single lookup.
+ */
+static uint8_t crc8_TableUpdate(const uint8_t *_table, uint8_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    return crc8_RegTable(_table, 8, true, _CRC, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a CRC16 register through the byte table
+ * @param _table Pointer to the 256-entry table
+ * @param _refIn true when the table and register are reflected (LSB-first)
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t CRC register after the data
+ */
+static uint16_t crc16_TableUpdate(const uint16_t *_table, bool _refIn, uint16_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    return crc16_RegTable(_table, 16, _refIn, _CRC, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a CRC32 register through the byte table
+ * @param _table Pointer to the 256-entry table
+ * @param _refIn true when the table and register are reflected (LSB-first)
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t CRC register after the data
+ */
+static uint32_t crc32_TableUpdate(const uint32_t *_table, bool _refIn, uint32_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    return crc32_RegTable(_table, 32, _refIn, _CRC, _data, _dataLength);
+};
+
+
+
+/**
+ * @brief Runs a CRC16 register through the fastest engine of a table context
+ * @param htable Pointer to CRC16 table context
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t CRC register after the data
+ * 
+ * @note Long buffers are folded with carry-less multiplication when
+ *       ERR_HW_CLMUL is enabled and the CPU supports it.
+ */
+static uint16_t crc16_TableRun(hcrc16Table_T *htable, uint16_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    bool _refIn = htable->Config.refIn;
+#if ERR_HW_CLMUL
+    uint8_t _Rem[16];
+    size_t _dataIndex = 0x00;
+
+    if(crc_ClmulUsable(_dataLength))
+    {
+        _dataIndex = crc_ClmulFold(htable->Fold, _refIn, 16, _CRC, _data, _dataLength, _Rem);
+        _CRC = crc16_TableUpdate(htable->Table, _refIn, 0x00, _Rem, 16);
+        _data += _dataIndex;
+        _dataLength -= _dataIndex;
+    };
+#endif
+
+    return crc16_TableUpdate(htable->Table, _refIn, _CRC, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a CRC32 register through the fastest engine of a table context
+ * @param htable Pointer to CRC32 table context
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t CRC register after the data
+ * 
+ * @note CRC-32C/CRC-32 go to the CRC instructions when ERR_HW_CRC is enabled,
+ *       other long buffers are folded with carry-less multiplication when
+ *       ERR_HW_CLMUL is enabled and the CPU supports it.
+ */
+static uint32_t crc32_TableRun(hcrc32Table_T *htable, uint32_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    bool _refIn = htable->Config.refIn;
+#if ERR_HW_CLMUL
+    uint8_t _Rem[16];
+    size_t _dataIndex = 0x00;
+#endif
+
+#if ERR_HW_CRC
+    if(_refIn && crc32_HwCalc(htable->Config.Poly, &_CRC, _data, _dataLength))
+    {
+        return _CRC;
+    };
+#endif
+
+#if ERR_HW_CLMUL
+    if(crc_ClmulUsable(_dataLength))
+    {
+        _dataIndex = crc_ClmulFold(htable->Fold, _refIn, 32, _CRC, _data, _dataLength, _Rem);
+        _CRC = crc32_TableUpdate(htable->Table, _refIn, 0x00, _Rem, 16);
+        _data += _dataIndex;
+        _dataLength -= _dataIndex;
+    };
+#endif
+
+    return crc32_TableUpdate(htable->Table, _refIn, _CRC, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a CRC32 register through the slicing-by-N tables
+ * @param hslice Pointer to CRC32 slicing context
+ * @param _CRC CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t CRC register after the data
+ * 
+ * @note The first four bytes of every block are XORed into the register and
+ *       all CRC32_SLICE_N lookups are independent, so they can overlap in the
+ *       pipeline. Bytes are loaded one at a time, so the data needs no
+ *       particular alignment or byte order. Remaining tail bytes go through
+ *       the byte table. CRC-32C/CRC-32 go to the CRC instructions when
+ *       ERR_HW_CRC is enabled.
+ */
+static uint32_t crc32_SliceUpdate(hcrc32Slice_T *hslice, uint32_t _CRC, const uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Word = 0x00;
+    uint8_t _sliceIndex = 0x00;
+    size_t _dataIndex = 0x00;
+
+    if(hslice->Config.refIn)
+    {
+#if ERR_HW_CRC
+        if(crc32_HwCalc(hslice->Config.Poly, &_CRC, _data, _dataLength))
+        {
+            return _CRC;
+        };
+#endif
+
+        for(; (_dataLength - _dataIndex) >= CRC32_SLICE_N; _dataIndex += CRC32_SLICE_N)
+        {
+            _Word = _CRC ^ ( (uint32_t)_data[_dataIndex]
+                           | ((uint32_t)_data[_dataIndex + 1] << 8)
+                           | ((uint32_t)_data[_dataIndex + 2] << 16)
+                           | ((uint32_t)_data[_dataIndex + 3] << 24));
+
+            _CRC = hslice->Table[CRC32_SLICE_N - 1][(uint8_t)_Word]
+                 ^ hslice->Table[CRC32_SLICE_N - 2][(uint8_t)(_Word >> 8)]
+                 ^ hslice->Table[CRC32_SLICE_N - 3][(uint8_t)(_Word >> 16)]
+                 ^ hslice->Table[CRC32_SLICE_N - 4][(uint8_t)(_Word >> 24)];
+
+            for(_sliceIndex = 4; _sliceIndex < CRC32_SLICE_N; _sliceIndex++)
+            {
+                _CRC ^= hslice->Table[CRC32_SLICE_N - 1 - _sliceIndex][_data[_dataIndex + _sliceIndex]];
+            };
+        };
+    }
+    else
+    {
+        for(; (_dataLength - _dataIndex) >= CRC32_SLICE_N; _dataIndex += CRC32_SLICE_N)
+        {
+            _Word = _CRC ^ ( ((uint32_t)_data[_dataIndex] << 24)
+                           | ((uint32_t)_data[_dataIndex + 1] << 16)
+                           | ((uint32_t)_data[_dataIndex + 2] << 8)
+                           |  (uint32_t)_data[_dataIndex + 3]);
+
+            _CRC = hslice->Table[CRC32_SLICE_N - 1][(uint8_t)(_Word >> 24)]
+                 ^ hslice->Table[CRC32_SLICE_N - 2][(uint8_t)(_Word >> 16)]
+                 ^ hslice->Table[CRC32_SLICE_N - 3][(uint8_t)(_Word >> 8)]
+                 ^ hslice->Table[CRC32_SLICE_N - 4][(uint8_t)_Word];
+
+            for(_sliceIndex = 4; _sliceIndex < CRC32_SLICE_N; _sliceIndex++)
+            {
+                _CRC ^= hslice->Table[CRC32_SLICE_N - 1 - _sliceIndex][_data[_dataIndex + _sliceIndex]];
+            };
+        };
+    };
+
+    return crc32_TableUpdate(hslice->Table[0], hslice->Config.refIn, _CRC, _data + _dataIndex, _dataLength - _dataIndex);
+};
+
+/**
+ * @brief Attribute of the multi-lane kernels
+ * @details GCC's straight-line vectorizer packs the independent lane
+ *          registers into one vector and rebuilds it after every lookup,
+ *          which serialises the lanes again; it is turned off for these
+ *          functions.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+  #define ERR_LANES __attribute__((optimize("no-tree-slp-vectorize")))
+#else
+  #define ERR_LANES
+#endif
+
+/**
+ * @brief Runs four independent CRC8 registers through the byte table in lockstep
+ * @param _table Pointer to the 256-entry table
+ * @param _CRC Pointer to the 4 CRC registers, updated in place
+ * @param _data Pointer to the 4 data pointers
+ * @param _dataLength Number of bytes fed to every register
+ * 
+ * @note The four lookup chains do not depend on each other, so their
+ *       load latencies overlap instead of adding up.
+ */
+ERR_LANES static void crc8_TableUpdate4(const uint8_t *_table, uint8_t *_CRC, const uint8_t *const *_data, size_t _dataLength)
+{
+    uint8_t _CRC0 = _CRC[0], _CRC1 = _CRC[1], _CRC2 = _CRC[2], _CRC3 = _CRC[3];
+    const uint8_t *_data0 = _data[0], *_data1 = _data[1], *_data2 = _data[2], *_data3 = _data[3];
+    size_t _dataIndex = 0x00;
+
+    for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+    {
+        _CRC0 = _table[_CRC0 ^ _data0[_dataIndex]];
+        _CRC1 = _table[_CRC1 ^ _data1[_dataIndex]];
+        _CRC2 = _table[_CRC2 ^ _data2[_dataIndex]];
+        _CRC3 = _table[_CRC3 ^ _data3[_dataIndex]];
+    };
+
+    _CRC[0] = _CRC0;
+    _CRC[1] = _CRC1;
+    _CRC[2] = _CRC2;
+    _CRC[3] = _CRC3;
+};
+
+
+/**
+ * @brief Runs four independent CRC16 registers through the byte table in lockstep
+ * @param _table Pointer to the 256-entry table
+ * @param _refIn true when the table and registers are reflected (LSB-first)
+ * @param _CRC Pointer to the 4 CRC registers, updated in place
+ * @param _data Pointer to the 4 data pointers
+ * @param _dataLength Number of bytes fed to every register
+ * 
+ * @note The four lookup chains do not depend on each other, so their
+ *       load latencies overlap instead of adding up.
+ */
+ERR_LANES static void crc16_TableUpdate4(const uint16_t *_table, bool _refIn, uint16_t *_CRC, const uint8_t *const *_data, size_t _dataLength)
+{
+    uint16_t _CRC0 = _CRC[0], _CRC1 = _CRC[1], _CRC2 = _CRC[2], _CRC3 = _CRC[3];
+    const uint8_t *_data0 = _data[0], *_data1 = _data[1], *_data2 = _data[2], *_data3 = _data[3];
+    size_t _dataIndex = 0x00;
+
+    if(_refIn)
+    {
+        for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+        {
+            _CRC0 = (_CRC0 >> 8) ^ _table[(uint8_t)_CRC0 ^ _data0[_dataIndex]];
+            _CRC1 = (_CRC1 >> 8) ^ _table[(uint8_t)_CRC1 ^ _data1[_dataIndex]];
+            _CRC2 = (_CRC2 >> 8) ^ _table[(uint8_t)_CRC2 ^ _data2[_dataIndex]];
+            _CRC3 = (_CRC3 >> 8) ^ _table[(uint8_t)_CRC3 ^ _data3[_dataIndex]];
+        };
+    }
+    else
+    {
+        for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+        {
+            _CRC0 = (_CRC0 << 8) ^ _table[(uint8_t)(_CRC0 >> 8) ^ _data0[_dataIndex]];
+            _CRC1 = (_CRC1 << 8) ^ _table[(uint8_t)(_CRC1 >> 8) ^ _data1[_dataIndex]];
+            _CRC2 = (_CRC2 << 8) ^ _table[(uint8_t)(_CRC2 >> 8) ^ _data2[_dataIndex]];
+            _CRC3 = (_CRC3 << 8) ^ _table[(uint8_t)(_CRC3 >> 8) ^ _data3[_dataIndex]];
+        };
+    };
+
+    _CRC[0] = _CRC0;
+    _CRC[1] = _CRC1;
+    _CRC[2] = _CRC2;
+    _CRC[3] = _CRC3;
+};
+
+
+#if ERR_HW_SIMD && defined(__x86_64__)
+/**
+ * @brief Loads 16 bytes of eight lanes and transposes them into byte columns
+ * @param _data Pointer to the 8 data pointers
+ * @param _offset Offset of the 16 bytes in every lane
+ * @param _column Receives 8 vectors: low half byte 2k, high half byte 2k + 1,
+ *                one byte per lane
+ */
+__attribute__((target("ssse3"))) static inline void crc16_SimdTranspose8(const uint8_t *const *_data, size_t _offset, __m128i *_column)
+{
+    __m128i _row[8];
+    __m128i _pair[8];
+    uint8_t _index = 0x00;
+
+    for(_index = 0; _index < 8; _index++)
+    {
+        _row[_index] = _mm_loadu_si128((const __m128i *)(_data[_index] + _offset));
+    };
+    for(_index = 0; _index < 8; _index += 2)
+    {
+        _pair[_index] = _mm_unpacklo_epi8(_row[_index], _row[_index + 1]);
+        _pair[_index + 1] = _mm_unpackhi_epi8(_row[_index], _row[_index + 1]);
+    };
+    for(_index = 0; _index < 8; _index += 4)
+    {
+        _row[_index] = _mm_unpacklo_epi16(_pair[_index], _pair[_index + 2]);
+        _row[_index + 1] = _mm_unpackhi_epi16(_pair[_index], _pair[_index + 2]);
+        _row[_index + 2] = _mm_unpacklo_epi16(_pair[_index + 1], _pair[_index + 3]);
+        _row[_index + 3] = _mm_unpackhi_epi16(_pair[_index + 1], _pair[_index + 3]);
+    };
+    for(_index = 0; _index < 4; _index++)
+    {
+        _column[2 * _index] = _mm_unpacklo_epi32(_row[_index], _row[_index + 4]);
+        _column[2 * _index + 1] = _mm_unpackhi_epi32(_row[_index], _row[_index + 4]);
+    };
+};
+
+
+/**
+ * @brief Runs eight independent CRC16 registers in lockstep, one per 16-bit SSE lane
+ * @param _table Pointer to the 256-entry table
+ * @param _refIn true when the table and registers are reflected (LSB-first)
+ * @param _CRC Pointer to the 8 CRC registers, updated in place
+ * @param _data Pointer to the 8 data pointers
+ * @param _dataLength Number of bytes fed to every register (multiple of 16)
+ * 
+ * @note The table is linear in its index, so Table[b] = Table[b & 0x0F] ^
+ *       Table[b & 0xF0]: both 16-entry halves fit in PSHUFB registers (low
+ *       and high bytes apart) and one byte of all eight lanes costs four
+ *       shuffles. Index lanes carry 0x80 in their high byte, which PSHUFB
+ *       turns into zero.
+ */
+__attribute__((target("ssse3"))) static void crc16_SimdUpdate8(const uint16_t *_table, bool _refIn, uint16_t *_CRC, const uint8_t *const *_data, size_t _dataLength)
+{
+    uint8_t _nibble[4][16];
+    __m128i _lowLo, _lowHi, _highLo, _highHi;
+    __m128i _mask = _mm_set1_epi16(0x000F);
+    __m128i _zeroIndex = _mm_set1_epi16((short)0x8000);
+    __m128i _zero = _mm_setzero_si128();
+    __m128i _reg = _mm_loadu_si128((const __m128i *)_CRC);
+    __m128i _column[8];
+    __m128i _byte, _index0, _index1;
+    size_t _dataIndex = 0x00;
+    uint8_t _index = 0x00;
+
+    for(_index = 0; _index < 16; _index++)
+    {
+        _nibble[0][_index] = (uint8_t)_table[_index];
+        _nibble[1][_index] = (uint8_t)(_table[_index] >> 8);
+        _nibble[2][_index] = (uint8_t)_table[_index << 4];
+        _nibble[3][_index] = (uint8_t)(_table[_index << 4] >> 8);
+    };
+    _lowLo = _mm_loadu_si128((const __m128i *)_nibble[0]);
+    _lowHi = _mm_loadu_si128((const __m128i *)_nibble[1]);
+    _highLo = _mm_loadu_si128((const __m128i *)_nibble[2]);
+    _highHi = _mm_loadu_si128((const __m128i *)_nibble[3]);
+
+    if(_refIn)
+    {
+        for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex += 16)
+        {
+            crc16_SimdTranspose8(_data, _dataIndex, _column);
+            for(_index = 0; _index < 16; _index++)
+            {
+                _byte = (_index & 0x01) ? _mm_unpackhi_epi8(_column[_index >> 1], _zero) : _mm_unpacklo_epi8(_column[_index >> 1], _zero);
+                _reg = _mm_xor_si128(_reg, _byte);
+                _index0 = _mm_or_si128(_mm_and_si128(_reg, _mask), _zeroIndex);
+                _index1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(_reg, 4), _mask), _zeroIndex);
+                _reg = _mm_xor_si128(_mm_srli_epi16(_reg, 8), _mm_xor_si128(_mm_shuffle_epi8(_lowLo, _index0), _mm_shuffle_epi8(_highLo, _index1)));
+                _reg = _mm_xor_si128(_reg, _mm_slli_epi16(_mm_xor_si128(_mm_shuffle_epi8(_lowHi, _index0), _mm_shuffle_epi8(_highHi, _index1)), 8));
+            };
+        };
+    }
+    else
+    {
+        for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex += 16)
+        {
+            crc16_SimdTranspose8(_data, _dataIndex, _column);
+            for(_index = 0; _index < 16; _index++)
+            {
+                _byte = (_index & 0x01) ? _mm_unpackhi_epi8(_column[_index >> 1], _zero) : _mm_unpacklo_epi8(_column[_index >> 1], _zero);
+                _reg = _mm_xor_si128(_reg, _mm_slli_epi16(_byte, 8));
+                _index0 = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(_reg, 8), _mask), _zeroIndex);
+                _index1 = _mm_or_si128(_mm_srli_epi16(_reg, 12), _zeroIndex);
+                _reg = _mm_xor_si128(_mm_slli_epi16(_reg, 8), _mm_xor_si128(_mm_shuffle_epi8(_lowLo, _index0), _mm_shuffle_epi8(_highLo, _index1)));
+                _reg = _mm_xor_si128(_reg, _mm_slli_epi16(_mm_xor_si128(_mm_shuffle_epi8(_lowHi, _index0), _mm_shuffle_epi8(_highHi, _index1)), 8));
+            };
+        };
+    };
+
+    _mm_storeu_si128((__m128i *)_CRC, _reg);
+};
+#endif
+
+
+/**
+ * @brief Runs four independent CRC32 registers through the byte table in lockstep
+ * @param _table Pointer to the 256-entry table
+ * @param _refIn true when the table and registers are reflected (LSB-first)
+ * @param _CRC Pointer to the 4 CRC registers, updated in place
+ * @param _data Pointer to the 4 data pointers
+ * @param _dataLength Number of bytes fed to every register
+ * 
+ * @note The four lookup chains do not depend on each other, so their
+ *       load latencies overlap instead of adding up.
+ */
+ERR_LANES static void crc32_TableUpdate4(const uint32_t *_table, bool _refIn, uint32_t *_CRC, const uint8_t *const *_data, size_t _dataLength)
+{
+    uint32_t _CRC0 = _CRC[0], _CRC1 = _CRC[1], _CRC2 = _CRC[2], _CRC3 = _CRC[3];
+    const uint8_t *_data0 = _data[0], *_data1 = _data[1], *_data2 = _data[2], *_data3 = _data[3];
+    size_t _dataIndex = 0x00;
+
+    if(_refIn)
+    {
+        for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+        {
+            _CRC0 = (_CRC0 >> 8) ^ _table[(uint8_t)_CRC0 ^ _data0[_dataIndex]];
+            _CRC1 = (_CRC1 >> 8) ^ _table[(uint8_t)_CRC1 ^ _data1[_dataIndex]];
+            _CRC2 = (_CRC2 >> 8) ^ _table[(uint8_t)_CRC2 ^ _data2[_dataIndex]];
+            _CRC3 = (_CRC3 >> 8) ^ _table[(uint8_t)_CRC3 ^ _data3[_dataIndex]];
+        };
+    }
+    else
+    {
+        for(_dataIndex = 0; _dataIndex < _dataLength; _dataIndex++)
+        {
+            _CRC0 = (_CRC0 << 8) ^ _table[(uint8_t)(_CRC0 >> 24) ^ _data0[_dataIndex]];
+            _CRC1 = (_CRC1 << 8) ^ _table[(uint8_t)(_CRC1 >> 24) ^ _data1[_dataIndex]];
+            _CRC2 = (_CRC2 << 8) ^ _table[(uint8_t)(_CRC2 >> 24) ^ _data2[_dataIndex]];
+            _CRC3 = (_CRC3 << 8) ^ _table[(uint8_t)(_CRC3 >> 24) ^ _data3[_dataIndex]];
+        };
+    };
+
+    _CRC[0] = _CRC0;
+    _CRC[1] = _CRC1;
+    _CRC[2] = _CRC2;
+    _CRC[3] = _CRC3;
+};
+
+/**
+ * @brief Checks a CRC8 trailer against the register of the bytes before it
+ * @param hcrc Pointer to CRC8 configuration
+ * @param _table Pointer to the 256-entry table, or NULL for the bitwise engine
+ * @param _CRC CRC register after the payload
+ * @param _trailer Pointer to the trailer byte
+ * @return bool true when the trailer matches
+ * 
+ * @note When refIn equals refOut the trailer is fed into the register and
+ *       the result compared with the residue of the configuration (the
+ *       register left by a correct CRC, xorOut fed into a zero register).
+ *       Otherwise (or for a polynomial without the +1 term, where feeding
+ *       the register is not one-to-one) the final CRC is compared directly.
+ */
+static bool crc8_Residue(hcrc8_T *hcrc, const uint8_t *_table, uint8_t _CRC, const uint8_t *_trailer)
+{
+    uint8_t _xorOut = hcrc->refIn ? (uint8_t) bitReflected(hcrc->xorOut, 8) : hcrc->xorOut;
+
+    if((hcrc->refIn != hcrc->refOut) || !(hcrc->Poly & 0x01))
+    {
+        return crc8_Final(hcrc, _CRC) == *_trailer;
+    };
+
+    if(_table != NULL)
+    {
+        return crc8_TableUpdate(_table, _CRC, _trailer, 1) == crc8_TableUpdate(_table, 0x00, &_xorOut, 1);
+    };
+
+    return crc8_BitUpdate(hcrc, _CRC, _trailer, 1) == crc8_BitUpdate(hcrc, 0x00, &_xorOut, 1);
+};
+
+
+/**
+ * @brief Checks a CRC16 trailer against the register of the bytes before it
+ * @param hcrc Pointer to CRC16 configuration
+ * @param _table Pointer to the 256-entry table, or NULL for the bitwise engine
+ * @param _CRC CRC register after the payload
+ * @param _trailer Pointer to the 2 trailer bytes
+ * @param _endian Byte order of the trailer
+ * @return bool true when the trailer matches
+ * 
+ * @note When refIn equals refOut the trailer bytes are fed into the register
+ *       in the order the register shifts them out (LSB first when reflected,
+ *       MSB first otherwise) and the result is compared with the residue of
+ *       the configuration: the register left by a correct CRC, which is
+ *       xorOut (in register order) fed into a zero register. When refIn and
+ *       refOut differ no residue exists, and for a polynomial without the +1
+ *       term feeding the register is not one-to-one; in both cases the final
+ *       CRC is compared with the trailer value instead.
+ */
+static bool crc16_Residue(hcrc16_T *hcrc, const uint16_t *_table, uint16_t _CRC, const uint8_t *_trailer, errEndian_T _endian)
+{
+    uint8_t _natural[2];
+    uint8_t _xorOut[2];
+    uint16_t _value = 0x00;
+    uint8_t _index = 0x00;
+    bool _swap = (_endian == ERR_ENDIAN_LITTLE) != hcrc->refIn;
+
+    if((hcrc->refIn != hcrc->refOut) || !(hcrc->Poly & 0x01))
+    {
+        for(_index = 0; _index < 2; _index++)
+        {
+            _value = (uint16_t)((_value << 8) | _trailer[(_endian == ERR_ENDIAN_BIG) ? _index : (1 - _index)]);
+        };
+        return crc16_Final(hcrc, _CRC) == _value;
+    };
+
+    _value = hcrc->refIn ? (uint16_t) bitReflected(hcrc->xorOut, 16) : hcrc->xorOut;
+    for(_index = 0; _index < 2; _index++)
+    {
+        _natural[_index] = _trailer[_swap ? (1 - _index) : _index];
+        _xorOut[_index] = (uint8_t)(_value >> (8 * (hcrc->refIn ? _index : (1 - _index))));
+    };
+
+    if(_table != NULL)
+    {
+        return crc16_TableUpdate(_table, hcrc->refIn, _CRC, _natural, 2) == crc16_TableUpdate(_table, hcrc->refIn, 0x00, _xorOut, 2);
+    };
+
+    return crc16_BitUpdate(hcrc, _CRC, _natural, 2) == crc16_BitUpdate(hcrc, 0x00, _xorOut, 2);
+};
+
+
+/**
+ * @brief Checks a CRC32 trailer against the register of the bytes before it
+ * @param hcrc Pointer to CRC32 configuration
+ * @param _table Pointer to the 256-entry table, or NULL for the bitwise engine
+ * @param _CRC CRC register after the payload
+ * @param _trailer Pointer to the 4 trailer bytes
+ * @param _endian Byte order of the trailer
+ * @return bool true when the trailer matches
+ * 
+ * @note When refIn equals refOut the trailer bytes are fed into the register
+ *       in the order the register shifts them out (LSB first when reflected,
+ *       MSB first otherwise) and the result is compared with the residue of
+ *       the configuration: the register left by a correct CRC, which is
+ *       xorOut (in register order) fed into a zero register. When refIn and
+ *       refOut differ no residue exists, and for a polynomial without the +1
+ *       term feeding the register is not one-to-one; in both cases the final
+ *       CRC is compared with the trailer value instead.
+ */
+static bool crc32_Residue(hcrc32_T *hcrc, const uint32_t *_table, uint32_t _CRC, const uint8_t *_trailer, errEndian_T _endian)
+{
+    uint8_t _natural[4];
+    uint8_t _xorOut[4];
+    uint32_t _value = 0x00;
+    uint8_t _index = 0x00;
+    bool _swap = (_endian == ERR_ENDIAN_LITTLE) != hcrc->refIn;
+
+    if((hcrc->refIn != hcrc->refOut) || !(hcrc->Poly & 0x01))
+    {
+        for(_index = 0; _index < 4; _index++)
+        {
+            _value = (uint32_t)((_value << 8) | _trailer[(_endian == ERR_ENDIAN_BIG) ? _index : (3 - _index)]);
+        };
+        return crc32_Final(hcrc, _CRC) == _value;
+    };
+
+    _value = hcrc->refIn ? (uint32_t) bitReflected(hcrc->xorOut, 32) : hcrc->xorOut;
+    for(_index = 0; _index < 4; _index++)
+    {
+        _natural[_index] = _trailer[_swap ? (3 - _index) : _index];
+        _xorOut[_index] = (uint8_t)(_value >> (8 * (hcrc->refIn ? _index : (3 - _index))));
+    };
+
+    if(_table != NULL)
+    {
+        return crc32_TableUpdate(_table, hcrc->refIn, _CRC, _natural, 4) == crc32_TableUpdate(_table, hcrc->refIn, 0x00, _xorOut, 4);
+    };
+
+    return crc32_BitUpdate(hcrc, _CRC, _natural, 4) == crc32_BitUpdate(hcrc, 0x00, _xorOut, 4);
+};
+
+
+#if (ERR_TABLE_CACHE_8 > 0) || (ERR_TABLE_CACHE_16 > 0) || (ERR_TABLE_CACHE_32 > 0)
+
+#define ERR_CACHE_READY  0x01  ///< Table cache slot holds a complete table
+
+/**
+ * @brief Table cache lock hooks (ERR_CACHE_LOCK() / ERR_CACHE_UNLOCK())
+ * @details Lookups of built tables are lock-free; only the first build of a
+ *          table runs between these two hooks. When they are not defined,
+ *          x86-64 / AArch64 GCC or Clang builds use a built-in spinlock and
+ *          other targets use empty hooks, which is safe when the cache is
+ *          only used from one context. Otherwise define both before
+ *          including err.h, e.g. __disable_irq()/__enable_irq() or an RTOS
+ *          mutex take/give. The hooks must also act as compiler memory
+ *          barriers.
+ */
+#if (defined(__x86_64__) || defined(__aarch64__)) && defined(__GNUC__)
+  #define ERR_CACHE_LOAD(_state)           __atomic_load_n(_state, __ATOMIC_ACQUIRE)
+  #define ERR_CACHE_STORE(_state, _value)  __atomic_store_n(_state, _value, __ATOMIC_RELEASE)
+  #if !defined(ERR_CACHE_LOCK)
+    static bool err_CacheBusy = false;
+    #define ERR_CACHE_LOCK()    while(__atomic_test_and_set(&err_CacheBusy, __ATOMIC_ACQUIRE)) {}
+    #define ERR_CACHE_UNLOCK()  __atomic_clear(&err_CacheBusy, __ATOMIC_RELEASE)
+  #endif
+#else
+  #define ERR_CACHE_LOAD(_state)           (*(volatile uint8_t *)(_state))
+  #define ERR_CACHE_STORE(_state, _value)  (*(volatile uint8_t *)(_state) = (_value))
+  #if !defined(ERR_CACHE_LOCK)
+    #define ERR_CACHE_LOCK()
+    #define ERR_CACHE_UNLOCK()
+  #endif
+#endif
+
+#endif
+
+
+/**
+ * @brief Generates the table cache of one CRC width
+ * @param _width CRC width (8, 16 or 32)
+ * 
+ * @note Defines crcXX_CacheGet, which returns the table of (Poly, refIn) from
+ *       a static pool of ERR_TABLE_CACHE_XX slots, building it in the first
+ *       free slot on a miss. Slots fill in order and are never reused, so
+ *       ready slots are searched without locking and returned pointers stay
+ *       valid; a slot is marked ready (release order) only after its table
+ *       is complete. Returns NULL when every slot holds another configuration.
+ */
+#define ERR_CRC_CACHE(_width)                                                                       \
+static hcrc##_width##Table_T crc##_width##_CacheTable[ERR_TABLE_CACHE_##_width];                    \
+static uint8_t crc##_width##_CacheState[ERR_TABLE_CACHE_##_width];                                  \
+                                                                                                    \
+static hcrc##_width##Table_T *crc##_width##_CacheGet(hcrc##_width##_T *hcrc)                        \
+{                                                                                                   \
+    hcrc##_width##_T _key = { hcrc->Poly, 0x00, hcrc->refIn, hcrc->refIn, 0x00 };                   \
+    hcrc##_width##Table_T *htable = NULL;                                                           \
+    size_t _slot = 0x00;                                                                            \
+                                                                                                    \
+    for(_slot = 0x00; _slot < ERR_TABLE_CACHE_##_width; _slot++)                                    \
+    {                                                                                               \
+        if(ERR_CACHE_LOAD(&crc##_width##_CacheState[_slot]) != ERR_CACHE_READY)                     \
+        {                                                                                           \
+            break;                                                                                  \
+        };                                                                                          \
+        htable = &crc##_width##_CacheTable[_slot];                                                  \
+        if((htable->Config.Poly == _key.Poly) && (htable->Config.refIn == _key.refIn))              \
+        {                                                                                           \
+            return htable;                                                                          \
+        };                                                                                          \
+    };                                                                                              \
+                                                                                                    \
+    htable = NULL;                                                                                  \
+    ERR_CACHE_LOCK();                                                                               \
+    for(; _slot < ERR_TABLE_CACHE_##_width; _slot++)                                                \
+    {                                                                                               \
+        if(ERR_CACHE_LOAD(&crc##_width##_CacheState[_slot]) != ERR_CACHE_READY)                     \
+        {                                                                                           \
+            htable = &crc##_width##_CacheTable[_slot];                                              \
+            CRC##_width##_TableInit(htable, &_key);                                                 \
+            ERR_CACHE_STORE(&crc##_width##_CacheState[_slot], ERR_CACHE_READY);                     \
+            break;                                                                                  \
+        };                                                                                          \
+        if((crc##_width##_CacheTable[_slot].Config.Poly == _key.Poly) &&                            \
+           (crc##_width##_CacheTable[_slot].Config.refIn == _key.refIn))                            \
+        {                                                                                           \
+            htable = &crc##_width##_CacheTable[_slot];                                              \
+            break;                                                                                  \
+        };                                                                                          \
+    };                                                                                              \
+    ERR_CACHE_UNLOCK();                                                                             \
+                                                                                                    \
+    return htable;                                                                                  \
+};
+
+/**
+ * @brief Generates the stub crcXX_CacheGet of a width whose cache is disabled
+ * @param _width CRC width (8, 16 or 32)
+ */
+#define ERR_CRC_CACHE_OFF(_width)                                                                   \
+static hcrc##_width##Table_T *crc##_width##_CacheGet(hcrc##_width##_T *hcrc)                        \
+{                                                                                                   \
+    (void)hcrc;                                                                                     \
+    return NULL;                                                                                    \
+};
+
+#if ERR_TABLE_CACHE_8 > 0
+ERR_CRC_CACHE(8)
+#else
+ERR_CRC_CACHE_OFF(8)
+#endif
+
+#if ERR_TABLE_CACHE_16 > 0
+ERR_CRC_CACHE(16)
+#else
+ERR_CRC_CACHE_OFF(16)
+#endif
+
+#if ERR_TABLE_CACHE_32 > 0
+ERR_CRC_CACHE(32)
+#else
+ERR_CRC_CACHE_OFF(32)
+#endif
+
+
+/**
+ * @brief CRC kernels: final CRC of a buffer for a configuration
+ * @details _ran receives the kernel that processed the data, which differs
+ *          from the selected one for ERR_KERNEL_AUTO and for fallbacks.
+ */
+typedef uint8_t (*crc8Kernel_T)(hcrc8_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran);
+typedef uint16_t (*crc16Kernel_T)(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran);
+typedef uint32_t (*crc32Kernel_T)(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran);
+
+
+/**
+ * @brief Generates the table-free CRC kernels of one width
+ * @param _type Register type (uint8_t, uint16_t or uint32_t)
+ * @param _width CRC width (8, 16 or 32)
+ * 
+ * @note Defines crcXX_KernelBit (ERR_KERNEL_BITWISE, never the CRC
+ *       instructions) and crcXX_KernelNibble (ERR_KERNEL_NIBBLE, the 16-entry
+ *       table is built on the stack by every call).
+ */
+#define ERR_CRC_KERNELS(_type, _width)                                                              \
+static _type crc##_width##_KernelBit(hcrc##_width##_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran) \
+{                                                                                                   \
+    _type _CRC = crc##_width##_RegBits(hcrc->Poly, _width, hcrc->refIn, crc##_width##_Start(hcrc), _data, _dataLength); \
+                                                                                                    \
+    *_ran = ERR_KERNEL_BITWISE;                                                                     \
+    return crc##_width##_Final(hcrc, _CRC);                                                         \
+};                                                                                                  \
+                                                                                                    \
+static _type crc##_width##_KernelNibble(hcrc##_width##_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran) \
+{                                                                                                   \
+    _type _table[16];                                                                               \
+                                                                                                    \
+    crc##_width##_RegNibbleBuild(_table, hcrc->Poly, _width, hcrc->refIn);                          \
+    *_ran = ERR_KERNEL_NIBBLE;                                                                      \
+                                                                                                    \
+    return crc##_width##_Final(hcrc, crc##_width##_RegNibble(_table, _width, hcrc->refIn, crc##_width##_Start(hcrc), _data, _dataLength)); \
+};
+
+ERR_CRC_KERNELS(uint8_t, 8)
+ERR_CRC_KERNELS(uint16_t, 16)
+ERR_CRC_KERNELS(uint32_t, 32)
+
+
+/**
+ * @brief Runs a CRC16 configuration through its cached table
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _tableLength Shortest buffer worth a table lookup, shorter ones run bitwise
+ * @param _fold true to fold long buffers with carry-less multiplication
+ * @param _ran Set to the kernel that processed the data
+ * @return uint16_t Final CRC value
+ * 
+ * @note Falls back to the bitwise engine when the table cache is full or disabled.
+ */
+static inline uint16_t crc16_KernelRun(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, size_t _tableLength, bool _fold, errKernel_T *_ran)
+{
+    hcrc16Table_T *htable = NULL;
+    uint16_t _CRC = crc16_Start(hcrc);
+#if ERR_HW_CLMUL
+    uint8_t _Rem[16];
+    size_t _dataIndex = 0x00;
+#endif
+
+    if(_dataLength >= _tableLength)
+    {
+        htable = crc16_CacheGet(hcrc);
+    };
+
+    if(htable == NULL)
+    {
+        *_ran = ERR_KERNEL_BITWISE;
+        return crc16_Final(hcrc, crc16_RegBits(hcrc->Poly, 16, hcrc->refIn, _CRC, _data, _dataLength));
+    };
+
+    *_ran = ERR_KERNEL_TABLE;
+#if ERR_HW_CLMUL
+    if(_fold && (_dataLength >= ERR_CLMUL_MIN_LENGTH))
+    {
+        *_ran = ERR_KERNEL_CLMUL;
+        _dataIndex = crc_ClmulFold(htable->Fold, hcrc->refIn, 16, _CRC, _data, _dataLength, _Rem);
+        _CRC = crc16_TableUpdate(htable->Table, hcrc->refIn, 0x00, _Rem, 16);
+        _data += _dataIndex;
+        _dataLength -= _dataIndex;
+    };
+#else
+    (void)_fold;
+#endif
+
+    return crc16_Final(hcrc, crc16_TableUpdate(htable->Table, hcrc->refIn, _CRC, _data, _dataLength));
+};
+
+
+/**
+ * @brief Runs a CRC32 configuration through the CRC instructions or its cached table
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _tableLength Shortest buffer worth a table lookup, shorter ones run bitwise
+ * @param _fold true to fold long buffers with carry-less multiplication
+ * @param _hw true to run CRC-32C (and CRC-32 on ARMv8) on the CRC instructions
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ * 
+ * @note Falls back to the bitwise engine when the table cache is full or disabled.
+ */
+static inline uint32_t crc32_KernelRun(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, size_t _tableLength, bool _fold, bool _hw, errKernel_T *_ran)
+{
+    hcrc32Table_T *htable = NULL;
+    uint32_t _CRC = crc32_Start(hcrc);
+#if ERR_HW_CLMUL
+    uint8_t _Rem[16];
+    size_t _dataIndex = 0x00;
+#endif
+
+#if ERR_HW_CRC
+    if(_hw && hcrc->refIn && (hcrc->Poly == ERR_POLY_CRC32C))
+    {
+        *_ran = ERR_KERNEL_HW;
+        return crc32_Final(hcrc, crc32c_HwUpdate(_CRC, _data, _dataLength));
+    };
+  #if defined(__aarch64__)
+    if(_hw && hcrc->refIn && (hcrc->Poly == ERR_POLY_CRC32))
+    {
+        *_ran = ERR_KERNEL_HW;
+        return crc32_Final(hcrc, crc32_HwUpdate(_CRC, _data, _dataLength));
+    };
+  #endif
+#else
+    (void)_hw;
+#endif
+
+    if(_dataLength >= _tableLength)
+    {
+        htable = crc32_CacheGet(hcrc);
+    };
+
+    if(htable == NULL)
+    {
+        *_ran = ERR_KERNEL_BITWISE;
+        return crc32_Final(hcrc, crc32_RegBits(hcrc->Poly, 32, hcrc->refIn, _CRC, _data, _dataLength));
+    };
+
+    *_ran = ERR_KERNEL_TABLE;
+#if ERR_HW_CLMUL
+    if(_fold && (_dataLength >= ERR_CLMUL_MIN_LENGTH))
+    {
+        *_ran = ERR_KERNEL_CLMUL;
+        _dataIndex = crc_ClmulFold(htable->Fold, hcrc->refIn, 32, _CRC, _data, _dataLength, _Rem);
+        _CRC = crc32_TableUpdate(htable->Table, hcrc->refIn, 0x00, _Rem, 16);
+        _data += _dataIndex;
+        _dataLength -= _dataIndex;
+    };
+#else
+    (void)_fold;
+#endif
+
+    return crc32_Final(hcrc, crc32_TableUpdate(htable->Table, hcrc->refIn, _CRC, _data, _dataLength));
+};
+
+
+/**
+ * @brief CRC8 kernel ERR_KERNEL_AUTO: cached table from ERR_DISPATCH_MIN_LENGTH bytes on
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint8_t Final CRC value
+ */
+static uint8_t crc8_KernelAuto(hcrc8_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    hcrc8Table_T *htable = NULL;
+
+    if(_dataLength >= ERR_DISPATCH_MIN_LENGTH)
+    {
+        htable = crc8_CacheGet(hcrc);
+    };
+
+    if(htable == NULL)
+    {
+        *_ran = ERR_KERNEL_BITWISE;
+        return crc8_Final(hcrc, crc8_RegBits(hcrc->Poly, 8, hcrc->refIn, crc8_Start(hcrc), _data, _dataLength));
+    };
+
+    *_ran = ERR_KERNEL_TABLE;
+    return crc8_Final(hcrc, crc8_TableUpdate(htable->Table, crc8_Start(hcrc), _data, _dataLength));
+};
+
+#if ERR_TABLE_CACHE_8 > 0
+/**
+ * @brief CRC8 kernel ERR_KERNEL_TABLE: cached table for every length
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint8_t Final CRC value
+ */
+static uint8_t crc8_KernelTable(hcrc8_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    hcrc8Table_T *htable = crc8_CacheGet(hcrc);
+
+    if(htable == NULL)
+    {
+        return crc8_KernelBit(hcrc, _data, _dataLength, _ran);
+    };
+
+    *_ran = ERR_KERNEL_TABLE;
+    return crc8_Final(hcrc, crc8_TableUpdate(htable->Table, crc8_Start(hcrc), _data, _dataLength));
+};
+#endif
+
+
+/**
+ * @brief CRC16 kernel ERR_KERNEL_AUTO on CPUs without carry-less multiply
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint16_t Final CRC value
+ */
+static uint16_t crc16_KernelAuto(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc16_KernelRun(hcrc, _data, _dataLength, ERR_DISPATCH_MIN_LENGTH, false, _ran);
+};
+
+#if ERR_TABLE_CACHE_16 > 0
+/**
+ * @brief CRC16 kernel ERR_KERNEL_TABLE: cached table for every length
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint16_t Final CRC value
+ */
+static uint16_t crc16_KernelTable(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc16_KernelRun(hcrc, _data, _dataLength, 0, false, _ran);
+};
+#endif
+
+#if ERR_HW_CLMUL && (ERR_TABLE_CACHE_16 > 0)
+/**
+ * @brief CRC16 kernel ERR_KERNEL_CLMUL: cached table, long buffers folded
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint16_t Final CRC value
+ */
+static uint16_t crc16_KernelClmul(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc16_KernelRun(hcrc, _data, _dataLength, 0, true, _ran);
+};
+
+/**
+ * @brief CRC16 kernel ERR_KERNEL_AUTO on CPUs with carry-less multiply
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint16_t Final CRC value
+ */
+static uint16_t crc16_KernelAutoClmul(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc16_KernelRun(hcrc, _data, _dataLength, ERR_DISPATCH_MIN_LENGTH, true, _ran);
+};
+#endif
+
+
+/**
+ * @brief CRC32 kernel ERR_KERNEL_AUTO on CPUs without CRC or carry-less multiply instructions
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelAuto(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc32_KernelRun(hcrc, _data, _dataLength, ERR_DISPATCH_MIN_LENGTH, false, false, _ran);
+};
+
+#if ERR_TABLE_CACHE_32 > 0
+/**
+ * @brief CRC32 kernel ERR_KERNEL_TABLE: cached table for every length
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelTable(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc32_KernelRun(hcrc, _data, _dataLength, 0, false, false, _ran);
+};
+#endif
+
+#if ERR_HW_CLMUL && (ERR_TABLE_CACHE_32 > 0)
+/**
+ * @brief CRC32 kernel ERR_KERNEL_CLMUL: cached table, long buffers folded
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelClmul(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc32_KernelRun(hcrc, _data, _dataLength, 0, true, false, _ran);
+};
+
+/**
+ * @brief CRC32 kernel ERR_KERNEL_AUTO on CPUs with carry-less multiply only
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelAutoClmul(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc32_KernelRun(hcrc, _data, _dataLength, ERR_DISPATCH_MIN_LENGTH, true, false, _ran);
+};
+#endif
+
+#if ERR_HW_CRC
+/**
+ * @brief CRC32 kernel ERR_KERNEL_HW: CRC instructions, bitwise for other configurations
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelHw(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc32_KernelRun(hcrc, _data, _dataLength, SIZE_MAX, false, true, _ran);
+};
+
+/**
+ * @brief CRC32 kernel ERR_KERNEL_AUTO on CPUs with CRC instructions only
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelAutoHw(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc32_KernelRun(hcrc, _data, _dataLength, ERR_DISPATCH_MIN_LENGTH, false, true, _ran);
+};
+
+  #if ERR_HW_CLMUL && (ERR_TABLE_CACHE_32 > 0)
+/**
+ * @brief CRC32 kernel ERR_KERNEL_AUTO on CPUs with CRC and carry-less multiply instructions
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelAutoHwClmul(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    return crc32_KernelRun(hcrc, _data, _dataLength, ERR_DISPATCH_MIN_LENGTH, true, true, _ran);
+};
+  #endif
+#endif
+
+
+/**
+ * @brief Gets the CRC8 kernel of a kernel id
+ * @param _kernel Kernel id
+ * @return crc8Kernel_T Kernel function, NULL when the build lacks it
+ */
+static crc8Kernel_T crc8_KernelFind(errKernel_T _kernel)
+{
+    if(_kernel == ERR_KERNEL_AUTO)
+    {
+        return crc8_KernelAuto;
+    };
+    if(_kernel == ERR_KERNEL_BITWISE)
+    {
+        return crc8_KernelBit;
+    };
+    if(_kernel == ERR_KERNEL_NIBBLE)
+    {
+        return crc8_KernelNibble;
+    };
+#if ERR_TABLE_CACHE_8 > 0
+    if(_kernel == ERR_KERNEL_TABLE)
+    {
+        return crc8_KernelTable;
+    };
+#endif
+
+    return NULL;
+};
+
+
+/**
+ * @brief Gets the CRC16 kernel of a kernel id
+ * @param _kernel Kernel id
+ * @return crc16Kernel_T Kernel function, NULL when the build or CPU lacks it
+ * 
+ * @note ERR_KERNEL_AUTO folds with carry-less multiplication when the CPU
+ *       supports it; the CPU is probed here, never by the kernels.
+ */
+static crc16Kernel_T crc16_KernelFind(errKernel_T _kernel)
+{
+#if ERR_HW_CLMUL && (ERR_TABLE_CACHE_16 > 0)
+    bool _clmul = (err_CpuDetect() & ERR_CPU_CLMUL) != 0;
+
+    if(_kernel == ERR_KERNEL_AUTO)
+    {
+        return _clmul ? crc16_KernelAutoClmul : crc16_KernelAuto;
+    };
+    if((_kernel == ERR_KERNEL_CLMUL) && _clmul)
+    {
+        return crc16_KernelClmul;
+    };
+#else
+    if(_kernel == ERR_KERNEL_AUTO)
+    {
+        return crc16_KernelAuto;
+    };
+#endif
+    if(_kernel == ERR_KERNEL_BITWISE)
+    {
+        return crc16_KernelBit;
+    };
+    if(_kernel == ERR_KERNEL_NIBBLE)
+    {
+        return crc16_KernelNibble;
+    };
+#if ERR_TABLE_CACHE_16 > 0
+    if(_kernel == ERR_KERNEL_TABLE)
+    {
+        return crc16_KernelTable;
+    };
+#endif
+
+    return NULL;
+};
+
+
+/**
+ * @brief Gets the CRC32 kernel of a kernel id
+ * @param _kernel Kernel id
+ * @return crc32Kernel_T Kernel function, NULL when the build or CPU lacks it
+ * 
+ * @note ERR_KERNEL_AUTO uses the CRC instructions and carry-less folding
+ *       the CPU supports; the CPU is probed here, never by the kernels.
+ */
+static crc32Kernel_T crc32_KernelFind(errKernel_T _kernel)
+{
+#if ERR_HW_CRC || ERR_HW_CLMUL
+    uint8_t _features = err_CpuDetect();
+#endif
+
+    if(_kernel == ERR_KERNEL_AUTO)
+    {
+#if ERR_HW_CRC && ERR_HW_CLMUL && (ERR_TABLE_CACHE_32 > 0)
+        if((_features & ERR_CPU_CRC) && (_features & ERR_CPU_CLMUL))
+        {
+            return crc32_KernelAutoHwClmul;
+        };
+#endif
+#if ERR_HW_CRC
+        if(_features & ERR_CPU_CRC)
+        {
+            return crc32_KernelAutoHw;
+        };
+#endif
+#if ERR_HW_CLMUL && (ERR_TABLE_CACHE_32 > 0)
+        if(_features & ERR_CPU_CLMUL)
+        {
+            return crc32_KernelAutoClmul;
+        };
+#endif
+        return crc32_KernelAuto;
+    };
+    if(_kernel == ERR_KERNEL_BITWISE)
+    {
+        return crc32_KernelBit;
+    };
+    if(_kernel == ERR_KERNEL_NIBBLE)
+    {
+        return crc32_KernelNibble;
+    };
+#if ERR_TABLE_CACHE_32 > 0
+    if(_kernel == ERR_KERNEL_TABLE)
+    {
+        return crc32_KernelTable;
+    };
+#endif
+#if ERR_HW_CLMUL && (ERR_TABLE_CACHE_32 > 0)
+    if((_kernel == ERR_KERNEL_CLMUL) && (_features & ERR_CPU_CLMUL))
+    {
+        return crc32_KernelClmul;
+    };
+#endif
+#if ERR_HW_CRC
+    if((_kernel == ERR_KERNEL_HW) && (_features & ERR_CPU_CRC))
+    {
+        return crc32_KernelHw;
+    };
+#endif
+
+    return NULL;
+};
+
+
+#if ERR_HW_CLMUL
+static uint16_t crc16_KernelResolve(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran);
+static crc16Kernel_T crc16_Kernel = crc16_KernelResolve;     ///< Active CRC16 kernel
+#else
+static crc16Kernel_T crc16_Kernel = crc16_KernelAuto;        ///< Active CRC16 kernel
+#endif
+
+#if ERR_HW_CRC || ERR_HW_CLMUL
+static uint32_t crc32_KernelResolve(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran);
+static crc32Kernel_T crc32_Kernel = crc32_KernelResolve;     ///< Active CRC32 kernel
+#else
+static crc32Kernel_T crc32_Kernel = crc32_KernelAuto;        ///< Active CRC32 kernel
+#endif
+
+static crc8Kernel_T crc8_Kernel = crc8_KernelAuto;           ///< Active CRC8 kernel
+
+#if ERR_HW_CLMUL
+/**
+ * @brief First CRC16 call: selects the default kernel for the CPU, then runs it
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint16_t Final CRC value
+ */
+static uint16_t crc16_KernelResolve(hcrc16_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    err_KernelSet(ERR_DISPATCH_CRC16, ERR_KERNEL_AUTO);
+
+    return ERR_KERNEL_LOAD(crc16_Kernel)(hcrc, _data, _dataLength, _ran);
+};
+#endif
+
+#if ERR_HW_CRC || ERR_HW_CLMUL
+/**
+ * @brief First CRC32 call: selects the default kernel for the CPU, then runs it
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @param _ran Set to the kernel that processed the data
+ * @return uint32_t Final CRC value
+ */
+static uint32_t crc32_KernelResolve(hcrc32_T *hcrc, const uint8_t *_data, size_t _dataLength, errKernel_T *_ran)
+{
+    err_KernelSet(ERR_DISPATCH_CRC32, ERR_KERNEL_AUTO);
+
+    return ERR_KERNEL_LOAD(crc32_Kernel)(hcrc, _data, _dataLength, _ran);
+};
+#endif
+
+
+/**
+ * @brief Selects the kernel behind a function family
+ * @param _family Function family (ERR_DISPATCH_xxx)
+ * @param _kernel Kernel to use from now on, ERR_KERNEL_AUTO for the default
+ * @return bool true when selected, false when the build or CPU lacks the
+ *         kernel (the previous selection is kept)
+ * 
+ * @note The CPU is probed here (once), so the Calc functions only make one
+ *       indirect call. A selection applies to calls that start after it;
+ *       make it before other threads start computing. Tables and slicing
+ *       contexts, the STM32 peripheral and the preset functions are not
+ *       affected: they already name their engine.
+ */
+bool err_KernelSet(errDispatch_T _family, errKernel_T _kernel)
+{
+    static const errKernel_T _sumOrder[4] = {ERR_KERNEL_AVX2, ERR_KERNEL_SIMD, ERR_KERNEL_SWAR, ERR_KERNEL_SCALAR};
+    crc8Kernel_T _crc8 = NULL;
+    crc16Kernel_T _crc16 = NULL;
+    crc32Kernel_T _crc32 = NULL;
+    errSumKernel_T _sum = NULL;
+    bool _found = false;
+    uint8_t _index = 0x00;
+
+    if(_family == ERR_DISPATCH_CRC8)
+    {
+        _crc8 = crc8_KernelFind(_kernel);
+        if(_crc8 == NULL)
+        {
+            return false;
+        };
+        ERR_KERNEL_STORE(crc8_Kernel, _crc8);
+    }
+    else if(_family == ERR_DISPATCH_CRC16)
+    {
+        _crc16 = crc16_KernelFind(_kernel);
+        if(_crc16 == NULL)
+        {
+            return false;
+        };
+        ERR_KERNEL_STORE(crc16_Kernel, _crc16);
+    }
+    else if(_family == ERR_DISPATCH_CRC32)
+    {
+        _crc32 = crc32_KernelFind(_kernel);
+        if(_crc32 == NULL)
+        {
+            return false;
+        };
+        ERR_KERNEL_STORE(crc32_Kernel, _crc32);
+    }
+    else if(_family == ERR_DISPATCH_SUM)
+    {
+        for(_index = 0; (_index < 4) && (_kernel == ERR_KERNEL_AUTO); _index++)
+        {
+            _sum = err_SumFind(_sumOrder[_index], &_found);
+            if(_found)
+            {
+                _kernel = _sumOrder[_index];
+            };
+        };
+
+        _sum = err_SumFind(_kernel, &_found);
+        if(!_found)
+        {
+            return false;
+        };
+        ERR_KERNEL_STORE(err_SumKernel, _sum);
+    }
+    else
+    {
+        return false;
+    };
+
+    ERR_KERNEL_STORE(err_KernelId[_family], _kernel);
+
+    return true;
+};
+
+
+/**
+ * @brief Gets the kernel behind a function family
+ * @param _family Function family (ERR_DISPATCH_xxx)
+ * @return errKernel_T Selected kernel; the CRC default stays ERR_KERNEL_AUTO
+ *         (it picks per buffer length), the checksum default is resolved
+ *         to the kernel it runs
+ */
+errKernel_T err_KernelGet(errDispatch_T _family)
+{
+    if(_family >= ERR_DISPATCH_COUNT)
+    {
+        return ERR_KERNEL_AUTO;
+    };
+
+    if((_family == ERR_DISPATCH_SUM) && (ERR_KERNEL_LOAD(err_KernelId[_family]) == ERR_KERNEL_AUTO))
+    {
+        err_KernelSet(ERR_DISPATCH_SUM, ERR_KERNEL_AUTO);
+    };
+
+    return ERR_KERNEL_LOAD(err_KernelId[_family]);
+};
+
+
+/**
+ * @brief Checks whether a kernel can be selected for a function family
+ * @param _family Function family (ERR_DISPATCH_xxx)
+ * @param _kernel Kernel to check
+ * @return bool true when err_KernelSet would accept it
+ */
+bool err_KernelAvailable(errDispatch_T _family, errKernel_T _kernel)
+{
+    bool _found = (_kernel == ERR_KERNEL_AUTO);
+
+    if(_family == ERR_DISPATCH_CRC8)
+    {
+        return crc8_KernelFind(_kernel) != NULL;
+    };
+    if(_family == ERR_DISPATCH_CRC16)
+    {
+        return crc16_KernelFind(_kernel) != NULL;
+    };
+    if(_family == ERR_DISPATCH_CRC32)
+    {
+        return crc32_KernelFind(_kernel) != NULL;
+    };
+    if((_family == ERR_DISPATCH_SUM) && !_found)
+    {
+        err_SumFind(_kernel, &_found);
+    };
+
+    return _found && (_family < ERR_DISPATCH_COUNT);
+};
+
+
+/**
+ * @brief Gets the name of a kernel
+ * @param _kernel Kernel
+ * @return const char* Lowercase name, "unknown" for an invalid id
+ */
+const char *err_KernelName(errKernel_T _kernel)
+{
+    static const char *const _names[ERR_KERNEL_COUNT] = {"auto", "bitwise", "nibble", "table", "clmul", "hw", "scalar", "swar", "simd", "avx2", "slice"};
+
+    return ((unsigned)_kernel < (unsigned)ERR_KERNEL_COUNT) ? _names[_kernel] : "unknown";
+};
+
+
+/**
+ * @brief Calculates 8-bit CRC value
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated CRC value
+ * 
+ * @note Implements standard CRC-8 algorithm with configurable:
+ *       - Polynomial
+ *       - Initial value
+ *       - Input/output reflection
+ *       - Final XOR
+ * @note Configurations with refIn set run the reflected (LSB-first)
+ *       algorithm instead of reflecting every input byte.
+ */
+uint8_t CRC8_Calc(hcrc8_T *hcrc, uint8_t *_data, uint16_t _dataLength)
+{
+    return CRC8_CalcLarge(hcrc, _data, _dataLength);
+};
+
+
+/**
+ * @brief Calculates 8-bit CRC value for a buffer of any size
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint8_t Calculated CRC value
+ */
+uint8_t CRC8_CalcLarge(hcrc8_T *hcrc, uint8_t *_data, size_t _dataLength)
+{
+    uint8_t _CRC = 0x00;
+    errKernel_T _kernel = ERR_KERNEL_AUTO;
+    ERR_STATS_BEGIN(ERR_ALGO_CRC8, _dataLength);
+
+    _CRC = ERR_KERNEL_LOAD(crc8_Kernel)(hcrc, _data, _dataLength, &_kernel);
+
+    return (uint8_t) ERR_STATS_END(ERR_ALGO_CRC8, _kernel, _CRC);
+};
+
+
+/**
+ * @brief Calculates 16-bit CRC value
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated CRC value
+ * 
+ * @note Implements standard CRC-16 algorithm with configurable:
+ *       - Polynomial
+ *       - Initial value
+ *       - Input/output reflection
+ *       - Final XOR
+ * @note Configurations with refIn set run the reflected (LSB-first)
+ *       algorithm instead of reflecting every input byte.
+ */
+uint16_t CRC16_Calc(hcrc16_T *hcrc, uint8_t *_data, uint16_t _dataLength)
+{
+    return CRC16_CalcLarge(hcrc, _data, _dataLength);
+};
+
+
+/**
+ * @brief Calculates 16-bit CRC value for a buffer of any size
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint16_t Calculated CRC value
+ */
+uint16_t CRC16_CalcLarge(hcrc16_T *hcrc, uint8_t *_data, size_t _dataLength)
+{
+    uint16_t _CRC = 0x00;
+    errKernel_T _kernel = ERR_KERNEL_AUTO;
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _dataLength);
+
+    _CRC = ERR_KERNEL_LOAD(crc16_Kernel)(hcrc, _data, _dataLength, &_kernel);
+
+    return (uint16_t) ERR_STATS_END(ERR_ALGO_CRC16, _kernel, _CRC);
+};
+
+
+/**
+ * @brief Calculates 32-bit CRC value
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated CRC value
+ * 
+ * @note Implements standard CRC-32 algorithm with configurable:
+ *       - Polynomial
+ *       - Initial value
+ *       - Input/output reflection
+ *       - Final XOR
+ * @note Configurations with refIn set run the reflected (LSB-first)
+ *       algorithm instead of reflecting every input byte.
+ */
+uint32_t CRC32_Calc(hcrc32_T *hcrc, uint8_t *_data, uint16_t _dataLength)
+{
+    return CRC32_CalcLarge(hcrc, _data, _dataLength);
+};
+
+
+/**
+ * @brief Calculates 32-bit CRC value for a buffer of any size
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint32_t Calculated CRC value
+ */
+uint32_t CRC32_CalcLarge(hcrc32_T *hcrc, uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _CRC = 0x00;
+    errKernel_T _kernel = ERR_KERNEL_AUTO;
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _dataLength);
+
+    _CRC = ERR_KERNEL_LOAD(crc32_Kernel)(hcrc, _data, _dataLength, &_kernel);
+
+    return (uint32_t) ERR_STATS_END(ERR_ALGO_CRC32, _kernel, _CRC);
+};
+
+
+/**
+ * @brief Builds the CRC8 lookup table for given configuration
+ * @param htable Pointer to CRC8 table context to fill
+ * @param hcrc Pointer to CRC8 configuration structure
+ * 
+ * @note Each entry holds the CRC register after shifting one byte
+ *       through the same loop used by CRC8_Calc: MSB-first with Poly,
+ *       or LSB-first with the reflected Poly when refIn is set.
+ */
+void CRC8_TableInit(hcrc8Table_T *htable, hcrc8_T *hcrc)
+{
+    htable->Config = *hcrc;
+    crc8_RegBuild(htable->Table, hcrc->Poly, 8, hcrc->refIn);
+};
+
+
+/**
+ * @brief Builds the CRC16 lookup table for given configuration
+ * @param htable Pointer to CRC16 table context to fill
+ * @param hcrc Pointer to CRC16 configuration structure
+ * 
+ * @note Each entry holds the CRC register after shifting one byte
+ *       through the same loop used by CRC16_Calc: MSB-first with Poly,
+ *       or LSB-first with the reflected Poly when refIn is set.
+ */
+void CRC16_TableInit(hcrc16Table_T *htable, hcrc16_T *hcrc)
+{
+    htable->Config = *hcrc;
+    crc16_RegBuild(htable->Table, hcrc->Poly, 16, hcrc->refIn);
+
+#if ERR_HW_CLMUL
+    crc_ClmulConstants(htable->Fold, hcrc->Poly, 16, hcrc->refIn);
+#endif
+};
+
+
+/**
+ * @brief Fills a 256-entry CRC32 lookup table for given configuration
+ * @param _table Pointer to the 256-entry table to fill
+ * @param hcrc Pointer to CRC32 configuration structure
+ * 
+ * @note Each entry holds the CRC register after shifting one byte
+ *       through the same loop used by CRC32_Calc: MSB-first with Poly,
+ *       or LSB-first with the reflected Poly when refIn is set.
+ */
+static void crc32_TableBuild(uint32_t *_table, hcrc32_T *hcrc)
+{
+    crc32_RegBuild(_table, hcrc->Poly, 32, hcrc->refIn);
+};
+
+
+/**
+ * @brief Builds the CRC32 lookup table for given configuration
+ * @param htable Pointer to CRC32 table context to fill
+ * @param hcrc Pointer to CRC32 configuration structure
+ */
+void CRC32_TableInit(hcrc32Table_T *htable, hcrc32_T *hcrc)
+{
+    htable->Config = *hcrc;
+    crc32_TableBuild(htable->Table, hcrc);
+
+#if ERR_HW_CLMUL
+    crc_ClmulConstants(htable->Fold, hcrc->Poly, 32, hcrc->refIn);
+#endif
+};
+
+
+/**
+ * @brief Calculates 8-bit CRC value using a lookup table
+ * @param htable Pointer to CRC8 table context built by CRC8_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated CRC value
+ * 
+ * @note Replaces the eight shift/XOR iterations per byte of CRC8_Calc
+ *       with a single table lookup. Reflected configurations use the
+ *       LSB-first table, so no input byte is ever reflected.
+ */
+uint8_t CRC8_TableCalc(hcrc8Table_T *htable, uint8_t *_data, size_t _dataLength)
+{
+    uint8_t _CRC = crc8_Start(&htable->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC8, _dataLength);
+
+    _CRC = crc8_TableUpdate(htable->Table, _CRC, _data, _dataLength);
+
+    return (uint8_t) ERR_STATS_END(ERR_ALGO_CRC8, ERR_KERNEL_TABLE, crc8_Final(&htable->Config, _CRC));
+};
+
+
+/**
+ * @brief Calculates 16-bit CRC value using a lookup table
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated CRC value
+ * 
+ * @note Replaces the eight shift/XOR iterations per byte of CRC16_Calc
+ *       with a single table lookup. Reflected configurations use the
+ *       LSB-first table, so no input byte is ever reflected.
+ *       Long buffers are folded with carry-less multiplication when
+ *       ERR_HW_CLMUL is enabled and the CPU supports it.
+ */
+uint16_t CRC16_TableCalc(hcrc16Table_T *htable, uint8_t *_data, size_t _dataLength)
+{
+    uint16_t _CRC = crc16_Start(&htable->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _dataLength);
+
+    _CRC = crc16_TableRun(htable, _CRC, _data, _dataLength);
+
+    return (uint16_t) ERR_STATS_END(ERR_ALGO_CRC16, ERR_KERNEL_TABLE, crc16_Final(&htable->Config, _CRC));
+};
+
+
+/**
+ * @brief Calculates 32-bit CRC value using a lookup table
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated CRC value
+ * 
+ * @note Replaces the eight shift/XOR iterations per byte of CRC32_Calc
+ *       with a single table lookup. Reflected configurations use the
+ *       LSB-first table, so no input byte is ever reflected.
+ *       CRC-32C/CRC-32 go to the CRC instructions when ERR_HW_CRC is enabled,
+ *       other long buffers are folded with carry-less multiplication when
+ *       ERR_HW_CLMUL is enabled and the CPU supports it.
+ */
+uint32_t CRC32_TableCalc(hcrc32Table_T *htable, uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _CRC = crc32_Start(&htable->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _dataLength);
+
+    _CRC = crc32_TableRun(htable, _CRC, _data, _dataLength);
+
+    return (uint32_t) ERR_STATS_END(ERR_ALGO_CRC32, ERR_KERNEL_TABLE, crc32_Final(&htable->Config, _CRC));
+};
+
+
+/**
+ * @brief Builds the CRC32 slicing-by-N tables for given configuration
+ * @param hslice Pointer to CRC32 slicing context to fill
+ * @param hcrc Pointer to CRC32 configuration structure
+ * 
+ * @note Table[0] is the regular byte table. Table[k][i] is the register
+ *       contribution of byte i followed by k zero bytes, which lets
+ *       CRC32_SliceCalc fold CRC32_SLICE_N bytes with independent lookups.
+ */
+void CRC32_SliceInit(hcrc32Slice_T *hslice, hcrc32_T *hcrc)
+{
+    uint32_t _CRC = 0x00;
+    uint8_t _sliceIndex = 0x00;
+    uint16_t _tableIndex = 0x00;
+
+    hslice->Config = *hcrc;
+    crc32_TableBuild(hslice->Table[0], hcrc);
+
+    for(_sliceIndex = 1; _sliceIndex < CRC32_SLICE_N; _sliceIndex++)
+    {
+        for(_tableIndex = 0; _tableIndex < 256; _tableIndex++)
+        {
+            _CRC = hslice->Table[_sliceIndex - 1][_tableIndex];
+
+            if(hcrc->refIn)
+            {
+                _CRC = (_CRC >> 8) ^ hslice->Table[0][(uint8_t)_CRC];
+            }
+            else
+            {
+                _CRC = (_CRC << 8) ^ hslice->Table[0][(uint8_t)(_CRC >> 24)];
+            };
+
+            hslice->Table[_sliceIndex][_tableIndex] = _CRC;
+        };
+    };
+};
+
+
+/**
+ * @brief Calculates 32-bit CRC value processing CRC32_SLICE_N bytes per iteration
+ * @param hslice Pointer to CRC32 slicing context built by CRC32_SliceInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated CRC value
+ */
+uint32_t CRC32_SliceCalc(hcrc32Slice_T *hslice, uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _CRC = crc32_Start(&hslice->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _dataLength);
+
+    _CRC = crc32_SliceUpdate(hslice, _CRC, _data, _dataLength);
+
+    return (uint32_t) ERR_STATS_END(ERR_ALGO_CRC32, ERR_KERNEL_SLICE, crc32_Final(&hslice->Config, _CRC));
+};
+
+/**
+ * @brief Builds the CRC8 nibble table for given configuration
+ * @param hnibble Pointer to CRC8 nibble table context to fill
+ * @param hcrc Pointer to CRC8 configuration structure
+ * 
+ * @note Entry i is the register after four shift/XOR steps of nibble i,
+ *       taken from the byte table loop: byte i<<4 for reflected
+ *       configurations (its low nibble only shifts), byte i otherwise.
+ */
+void CRC8_NibbleInit(hcrc8Nibble_T *hnibble, hcrc8_T *hcrc)
+{
+    hnibble->Config = *hcrc;
+    crc8_RegNibbleBuild(hnibble->Table, hcrc->Poly, 8, hcrc->refIn);
+};
+
+
+/**
+ * @brief Builds the CRC16 nibble table for given configuration
+ * @param hnibble Pointer to CRC16 nibble table context to fill
+ * @param hcrc Pointer to CRC16 configuration structure
+ */
+void CRC16_NibbleInit(hcrc16Nibble_T *hnibble, hcrc16_T *hcrc)
+{
+    hnibble->Config = *hcrc;
+    crc16_RegNibbleBuild(hnibble->Table, hcrc->Poly, 16, hcrc->refIn);
+};
+
+
+/**
+ * @brief Builds the CRC32 nibble table for given configuration
+ * @param hnibble Pointer to CRC32 nibble table context to fill
+ * @param hcrc Pointer to CRC32 configuration structure
+ */
+void CRC32_NibbleInit(hcrc32Nibble_T *hnibble, hcrc32_T *hcrc)
+{
+    hnibble->Config = *hcrc;
+    crc32_RegNibbleBuild(hnibble->Table, hcrc->Poly, 32, hcrc->refIn);
+};
+
+
+/**
+ * @brief Calculates 8-bit CRC value with two 16-entry table lookups per byte
+ * @param hnibble Pointer to CRC8 nibble table context built by CRC8_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated CRC value
+ * 
+ * @note Two lookups per byte instead of the eight shift/XOR steps of
+ *       CRC8_Calc, with a 16-byte table instead of 256 bytes.
+ */
+uint8_t CRC8_NibbleCalc(hcrc8Nibble_T *hnibble, uint8_t *_data, size_t _dataLength)
+{
+    uint8_t _CRC = crc8_Start(&hnibble->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC8, _dataLength);
+
+    _CRC = crc8_RegNibble(hnibble->Table, 8, hnibble->Config.refIn, _CRC, _data, _dataLength);
+
+    return (uint8_t) ERR_STATS_END(ERR_ALGO_CRC8, ERR_KERNEL_NIBBLE, crc8_Final(&hnibble->Config, _CRC));
+};
+
+
+/**
+ * @brief Calculates 16-bit CRC value with two 16-entry table lookups per byte
+ * @param hnibble Pointer to CRC16 nibble table context built by CRC16_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated CRC value
+ */
+uint16_t CRC16_NibbleCalc(hcrc16Nibble_T *hnibble, uint8_t *_data, size_t _dataLength)
+{
+    uint16_t _CRC = crc16_Start(&hnibble->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _dataLength);
+
+    _CRC = crc16_RegNibble(hnibble->Table, 16, hnibble->Config.refIn, _CRC, _data, _dataLength);
+
+    return (uint16_t) ERR_STATS_END(ERR_ALGO_CRC16, ERR_KERNEL_NIBBLE, crc16_Final(&hnibble->Config, _CRC));
+};
+
+
+/**
+ * @brief Calculates 32-bit CRC value with two 16-entry table lookups per byte
+ * @param hnibble Pointer to CRC32 nibble table context built by CRC32_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated CRC value
+ */
+uint32_t CRC32_NibbleCalc(hcrc32Nibble_T *hnibble, uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _CRC = crc32_Start(&hnibble->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _dataLength);
+
+    _CRC = crc32_RegNibble(hnibble->Table, 32, hnibble->Config.refIn, _CRC, _data, _dataLength);
+
+    return (uint32_t) ERR_STATS_END(ERR_ALGO_CRC32, ERR_KERNEL_NIBBLE, crc32_Final(&hnibble->Config, _CRC));
+};
+
+
+/**
+ * @brief Starts a streaming CRC8 calculation with the bitwise engine
+ * @param hctx Pointer to CRC8 streaming context to initialize
+ * @param hcrc Pointer to CRC8 configuration structure (must stay valid)
+ */
+void CRC8_Init(hcrc8Ctx_T *hctx, hcrc8_T *hcrc)
+{
+    hctx->hcrc = hcrc;
+    hctx->htable = NULL;
+    hctx->Reg = crc8_Start(hcrc);
+};
+
+
+/**
+ * @brief Starts a streaming CRC16 calculation with the bitwise engine
+ * @param hctx Pointer to CRC16 streaming context to initialize
+ * @param hcrc Pointer to CRC16 configuration structure (must stay valid)
+ */
+void CRC16_Init(hcrc16Ctx_T *hctx, hcrc16_T *hcrc)
+{
+    hctx->hcrc = hcrc;
+    hctx->htable = NULL;
+    hctx->Reg = crc16_Start(hcrc);
+};
+
+
+/**
+ * @brief Starts a streaming CRC32 calculation with the bitwise engine
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param hcrc Pointer to CRC32 configuration structure (must stay valid)
+ */
+void CRC32_Init(hcrc32Ctx_T *hctx, hcrc32_T *hcrc)
+{
+    hctx->hcrc = hcrc;
+    hctx->htable = NULL;
+    hctx->hslice = NULL;
+    hctx->Reg = crc32_Start(hcrc);
+};
+
+
+/**
+ * @brief Starts a streaming CRC8 calculation with the table engine
+ * @param hctx Pointer to CRC8 streaming context to initialize
+ * @param htable Pointer to CRC8 table context built by CRC8_TableInit (must stay valid)
+ */
+void CRC8_InitTable(hcrc8Ctx_T *hctx, hcrc8Table_T *htable)
+{
+    hctx->hcrc = &htable->Config;
+    hctx->htable = htable;
+    hctx->Reg = crc8_Start(&htable->Config);
+};
+
+
+/**
+ * @brief Starts a streaming CRC16 calculation with the table engine
+ * @param hctx Pointer to CRC16 streaming context to initialize
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit (must stay valid)
+ */
+void CRC16_InitTable(hcrc16Ctx_T *hctx, hcrc16Table_T *htable)
+{
+    hctx->hcrc = &htable->Config;
+    hctx->htable = htable;
+    hctx->Reg = crc16_Start(&htable->Config);
+};
+
+
+/**
+ * @brief Starts a streaming CRC32 calculation with the table engine
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit (must stay valid)
+ */
+void CRC32_InitTable(hcrc32Ctx_T *hctx, hcrc32Table_T *htable)
+{
+    hctx->hcrc = &htable->Config;
+    hctx->htable = htable;
+    hctx->hslice = NULL;
+    hctx->Reg = crc32_Start(&htable->Config);
+};
+
+
+/**
+ * @brief Starts a streaming CRC32 calculation with the slicing-by-N engine
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param hslice Pointer to CRC32 slicing context built by CRC32_SliceInit (must stay valid)
+ */
+void CRC32_InitSlice(hcrc32Ctx_T *hctx, hcrc32Slice_T *hslice)
+{
+    hctx->hcrc = &hslice->Config;
+    hctx->htable = NULL;
+    hctx->hslice = hslice;
+    hctx->Reg = crc32_Start(&hslice->Config);
+};
+
+
+/**
+ * @brief Gets the shared table of a CRC8 configuration, building it on first use
+ * @param hcrc Pointer to CRC8 configuration structure (only Poly and refIn are used)
+ * @return const hcrc8Table_T* Cached table, or NULL when the cache is full or disabled
+ * 
+ * @note The table is keyed by (Poly, refIn) only, so configurations that differ
+ *       in Init/refOut/xorOut share it; its Config holds Poly and refIn with
+ *       Init = xorOut = 0 and refOut = refIn. Thread-safe, see ERR_CACHE_LOCK.
+ */
+const hcrc8Table_T *CRC8_TableGet(hcrc8_T *hcrc)
+{
+    return crc8_CacheGet(hcrc);
+};
+
+
+/**
+ * @brief Gets the shared table of a CRC16 configuration, building it on first use
+ * @param hcrc Pointer to CRC16 configuration structure (only Poly and refIn are used)
+ * @return const hcrc16Table_T* Cached table, or NULL when the cache is full or disabled
+ * 
+ * @note The table is keyed by (Poly, refIn) only, so configurations that differ
+ *       in Init/refOut/xorOut share it; its Config holds Poly and refIn with
+ *       Init = xorOut = 0 and refOut = refIn. Thread-safe, see ERR_CACHE_LOCK.
+ */
+const hcrc16Table_T *CRC16_TableGet(hcrc16_T *hcrc)
+{
+    return crc16_CacheGet(hcrc);
+};
+
+
+/**
+ * @brief Gets the shared table of a CRC32 configuration, building it on first use
+ * @param hcrc Pointer to CRC32 configuration structure (only Poly and refIn are used)
+ * @return const hcrc32Table_T* Cached table, or NULL when the cache is full or disabled
+ * 
+ * @note The table is keyed by (Poly, refIn) only, so configurations that differ
+ *       in Init/refOut/xorOut share it; its Config holds Poly and refIn with
+ *       Init = xorOut = 0 and refOut = refIn. Thread-safe, see ERR_CACHE_LOCK.
+ */
+const hcrc32Table_T *CRC32_TableGet(hcrc32_T *hcrc)
+{
+    return crc32_CacheGet(hcrc);
+};
+
+
+/**
+ * @brief Calculates 8-bit CRC value with the cached table of its configuration
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated CRC value
+ * 
+ * @note Same result as CRC8_Calc. The first call for a (Poly, refIn) pair
+ *       builds its table; later calls, also with other Init/xorOut values,
+ *       reuse it. Falls back to the bitwise engine when the cache is full.
+ */
+uint8_t CRC8_CachedCalc(hcrc8_T *hcrc, uint8_t *_data, size_t _dataLength)
+{
+    hcrc8Table_T *htable = crc8_CacheGet(hcrc);
+    uint8_t _CRC = crc8_Start(hcrc);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC8, _dataLength);
+
+    if(htable != NULL)
+    {
+        _CRC = crc8_TableUpdate(htable->Table, _CRC, _data, _dataLength);
+    }
+    else
+    {
+        _CRC = crc8_BitUpdate(hcrc, _CRC, _data, _dataLength);
+    };
+
+    return (uint8_t) ERR_STATS_END(ERR_ALGO_CRC8, (htable != NULL) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE, crc8_Final(hcrc, _CRC));
+};
+
+
+/**
+ * @brief Calculates 16-bit CRC value with the cached table of its configuration
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated CRC value
+ * 
+ * @note Same result as CRC16_Calc. The first call for a (Poly, refIn) pair
+ *       builds its table; later calls, also with other Init/xorOut values,
+ *       reuse it. Falls back to the bitwise engine when the cache is full.
+ */
+uint16_t CRC16_CachedCalc(hcrc16_T *hcrc, uint8_t *_data, size_t _dataLength)
+{
+    hcrc16Table_T *htable = crc16_CacheGet(hcrc);
+    uint16_t _CRC = crc16_Start(hcrc);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _dataLength);
+
+    if(htable != NULL)
+    {
+        _CRC = crc16_TableRun(htable, _CRC, _data, _dataLength);
+    }
+    else
+    {
+        _CRC = crc16_BitUpdate(hcrc, _CRC, _data, _dataLength);
+    };
+
+    return (uint16_t) ERR_STATS_END(ERR_ALGO_CRC16, (htable != NULL) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE, crc16_Final(hcrc, _CRC));
+};
+
+
+/**
+ * @brief Calculates 32-bit CRC value with the cached table of its configuration
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated CRC value
+ * 
+ * @note Same result as CRC32_Calc. The first call for a (Poly, refIn) pair
+ *       builds its table; later calls, also with other Init/xorOut values,
+ *       reuse it. Falls back to the bitwise engine when the cache is full.
+ */
+uint32_t CRC32_CachedCalc(hcrc32_T *hcrc, uint8_t *_data, size_t _dataLength)
+{
+    hcrc32Table_T *htable = crc32_CacheGet(hcrc);
+    uint32_t _CRC = crc32_Start(hcrc);
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _dataLength);
+
+    if(htable != NULL)
+    {
+        _CRC = crc32_TableRun(htable, _CRC, _data, _dataLength);
+    }
+    else
+    {
+        _CRC = crc32_BitUpdate(hcrc, _CRC, _data, _dataLength);
+    };
+
+    return (uint32_t) ERR_STATS_END(ERR_ALGO_CRC32, (htable != NULL) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE, crc32_Final(hcrc, _CRC));
+};
+
+
+/**
+ * @brief Starts a streaming CRC8 calculation with the cached table of its configuration
+ * @param hctx Pointer to CRC8 streaming context to initialize
+ * @param hcrc Pointer to CRC8 configuration structure (must stay valid)
+ * 
+ * @note Uses the bitwise engine when the cache is full or disabled.
+ */
+void CRC8_InitCached(hcrc8Ctx_T *hctx, hcrc8_T *hcrc)
+{
+    hctx->hcrc = hcrc;
+    hctx->htable = crc8_CacheGet(hcrc);
+    hctx->Reg = crc8_Start(hcrc);
+};
+
+
+/**
+ * @brief Starts a streaming CRC16 calculation with the cached table of its configuration
+ * @param hctx Pointer to CRC16 streaming context to initialize
+ * @param hcrc Pointer to CRC16 configuration structure (must stay valid)
+ * 
+ * @note Uses the bitwise engine when the cache is full or disabled.
+ */
+void CRC16_InitCached(hcrc16Ctx_T *hctx, hcrc16_T *hcrc)
+{
+    hctx->hcrc = hcrc;
+    hctx->htable = crc16_CacheGet(hcrc);
+    hctx->Reg = crc16_Start(hcrc);
+};
+
+
+/**
+ * @brief Starts a streaming CRC32 calculation with the cached table of its configuration
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param hcrc Pointer to CRC32 configuration structure (must stay valid)
+ * 
+ * @note Uses the bitwise engine when the cache is full or disabled.
+ */
+void CRC32_InitCached(hcrc32Ctx_T *hctx, hcrc32_T *hcrc)
+{
+    hctx->hcrc = hcrc;
+    hctx->htable = crc32_CacheGet(hcrc);
+    hctx->hslice = NULL;
+    hctx->Reg = crc32_Start(hcrc);
+};
+
+
+/**
+ * @brief Feeds the next fragment of a message into a streaming CRC8 calculation
+ * @param hctx Pointer to CRC8 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ * 
+ * @note Only the raw register is updated; xorOut and refOut are applied
+ *       by CRC8_Final, so fragments of any size can be fed in any number
+ *       of calls (for example one byte per UART interrupt).
+ */
+void CRC8_Update(hcrc8Ctx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRC8, _dataLength);
+
+    if(hctx->htable != NULL)
+    {
+        hctx->Reg = crc8_TableUpdate(hctx->htable->Table, hctx->Reg, _data, _dataLength);
+    }
+    else
+    {
+        hctx->Reg = crc8_BitUpdate(hctx->hcrc, hctx->Reg, _data, _dataLength);
+    };
+
+    ERR_STATS_DONE(ERR_ALGO_CRC8, (hctx->htable != NULL) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE);
+};
+
+
+/**
+ * @brief Feeds the next fragment of a message into a streaming CRC16 calculation
+ * @param hctx Pointer to CRC16 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void CRC16_Update(hcrc16Ctx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _dataLength);
+
+    if(hctx->htable != NULL)
+    {
+        hctx->Reg = crc16_TableRun(hctx->htable, hctx->Reg, _data, _dataLength);
+    }
+    else
+    {
+        hctx->Reg = crc16_BitUpdate(hctx->hcrc, hctx->Reg, _data, _dataLength);
+    };
+
+    ERR_STATS_DONE(ERR_ALGO_CRC16, (hctx->htable != NULL) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE);
+};
+
+
+/**
+ * @brief Feeds the next fragment of a message into a streaming CRC32 calculation
+ * @param hctx Pointer to CRC32 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void CRC32_Update(hcrc32Ctx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _dataLength);
+
+    if(hctx->hslice != NULL)
+    {
+        hctx->Reg = crc32_SliceUpdate(hctx->hslice, hctx->Reg, _data, _dataLength);
+    }
+    else if(hctx->htable != NULL)
+    {
+        hctx->Reg = crc32_TableRun(hctx->htable, hctx->Reg, _data, _dataLength);
+    }
+    else
+    {
+        hctx->Reg = crc32_BitUpdate(hctx->hcrc, hctx->Reg, _data, _dataLength);
+    };
+
+    ERR_STATS_DONE(ERR_ALGO_CRC32, (hctx->hslice != NULL) ? ERR_KERNEL_SLICE : ((hctx->htable != NULL) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE));
+};
+
+
+/**
+ * @brief Feeds a chain of buffer segments into a streaming CRC8 calculation
+ * @param hctx Pointer to CRC8 streaming context
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ */
+void CRC8_UpdateSG(hcrc8Ctx_T *hctx, errBuffer_T *_segments, size_t _count)
+{
+    for(; _count > 0; _count--, _segments++)
+    {
+        CRC8_Update(hctx, _segments->Data, _segments->Length);
+    };
+};
+
+
+/**
+ * @brief Feeds a chain of buffer segments into a streaming CRC16 calculation
+ * @param hctx Pointer to CRC16 streaming context
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * 
+ * @note The CRC16 engines step one byte at a time (or fold whole segments),
+ *       so segment edges cost nothing extra and each segment is fed directly.
+ */
+void CRC16_UpdateSG(hcrc16Ctx_T *hctx, errBuffer_T *_segments, size_t _count)
+{
+    for(; _count > 0; _count--, _segments++)
+    {
+        CRC16_Update(hctx, _segments->Data, _segments->Length);
+    };
+};
+
+
+/**
+ * @brief Feeds a chain of buffer segments into a streaming CRC32 calculation
+ * @param hctx Pointer to CRC32 streaming context
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * 
+ * @note The slicing engine and the CRC-32/CRC-32C instructions consume whole
+ *       words and finish partial words byte by byte. To keep segment edges
+ *       on the word path, only a multiple of 16 bytes of every segment is fed
+ *       directly; the 0..15 leftover bytes are joined with the head of the
+ *       next segment in a 16-byte block. The byte table and bitwise engines
+ *       gain nothing from this, the carry is only a copy for them.
+ */
+void CRC32_UpdateSG(hcrc32Ctx_T *hctx, errBuffer_T *_segments, size_t _count)
+{
+    uint8_t _Carry[16];
+    uint8_t _carryLength = 0x00;
+    uint8_t *_data = NULL;
+    size_t _dataLength = 0x00;
+    size_t _bulkLength = 0x00;
+
+    for(; _count > 0; _count--, _segments++)
+    {
+        _data = _segments->Data;
+        _dataLength = _segments->Length;
+
+        for(; (_carryLength > 0) && (_carryLength < 16) && (_dataLength > 0); _carryLength++, _data++, _dataLength--)
+        {
+            _Carry[_carryLength] = *_data;
+        };
+
+        if(_carryLength == 16)
+        {
+            CRC32_Update(hctx, _Carry, 16);
+            _carryLength = 0x00;
+        };
+
+        if(_carryLength > 0)
+        {
+            continue;
+        };
+
+        _bulkLength = _dataLength & ~((size_t)0x0F);
+        CRC32_Update(hctx, _data, _bulkLength);
+
+        for(_data += _bulkLength; _bulkLength < _dataLength; _bulkLength++, _data++)
+        {
+            _Carry[_carryLength++] = *_data;
+        };
+    };
+
+    CRC32_Update(hctx, _Carry, _carryLength);
+};
+
+
+/**
+ * @brief Returns the CRC8 of all fragments fed so far
+ * @param hctx Pointer to CRC8 streaming context
+ * @return uint8_t Final CRC value (xorOut and refOut applied)
+ * 
+ * @note The context is not modified, so more fragments may still be
+ *       added afterwards; call CRC8_Init again to start a new message.
+ */
+uint8_t CRC8_Final(hcrc8Ctx_T *hctx)
+{
+    return crc8_Final(hctx->hcrc, hctx->Reg);
+};
+
+
+/**
+ * @brief Returns the CRC16 of all fragments fed so far
+ * @param hctx Pointer to CRC16 streaming context
+ * @return uint16_t Final CRC value (xorOut and refOut applied)
+ */
+uint16_t CRC16_Final(hcrc16Ctx_T *hctx)
+{
+    return crc16_Final(hctx->hcrc, hctx->Reg);
+};
+
+
+/**
+ * @brief Returns the CRC32 of all fragments fed so far
+ * @param hctx Pointer to CRC32 streaming context
+ * @return uint32_t Final CRC value (xorOut and refOut applied)
+ */
+uint32_t CRC32_Final(hcrc32Ctx_T *hctx)
+{
+    return crc32_Final(hctx->hcrc, hctx->Reg);
+};
+
+/**
+ * @brief Returns the mask of the low _width bits
+ * @param _width CRC width in bits (1..64)
+ * @return uint64_t Mask of the register bits
+ */
+static uint64_t crcN_Mask(uint8_t _width)
+{
+    return (_width >= 64) ? 0xFFFFFFFFFFFFFFFFULL : ((1ULL << _width) - 1ULL);
+};
+
+
+/**
+ * @brief Returns the generic CRC register value before the first data byte
+ * @param hcrc Pointer to generic CRC configuration structure
+ * @return uint64_t Initial CRC register
+ */
+static uint64_t crcN_Start(hcrcN_T *hcrc)
+{
+    return crcN_RegStart(hcrc->Width, hcrc->refIn, hcrc->Init & crcN_Mask(hcrc->Width));
+};
+
+
+/**
+ * @brief Applies final XOR and output reflection to a generic CRC register
+ * @param hcrc Pointer to generic CRC configuration structure
+ * @param _Reg CRC register after the last data byte
+ * @return uint64_t Final CRC value
+ */
+static uint64_t crcN_Final(hcrcN_T *hcrc, uint64_t _Reg)
+{
+    return crcN_RegFinal(hcrc->Width, hcrc->refIn, hcrc->refOut, hcrc->xorOut & crcN_Mask(hcrc->Width), _Reg);
+};
+
+
+/**
+ * @brief Runs a generic CRC register through the data bit by bit
+ * @param hcrc Pointer to generic CRC configuration structure
+ * @param _Reg CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t CRC register after the data
+ * 
+ * @note Widths up to 32 run on the 32-bit kernel (and CRC-32C/CRC-32 on the
+ *       CRC instructions when ERR_HW_CRC is enabled), wider ones on the
+ *       64-bit kernel.
+ */
+static uint64_t crcN_BitUpdate(hcrcN_T *hcrc, uint64_t _Reg, const uint8_t *_data, size_t _dataLength)
+{
+    uint64_t _Poly = hcrc->Poly & crcN_Mask(hcrc->Width);
+#if ERR_HW_CRC
+    uint32_t _CRC = (uint32_t)_Reg;
+
+    if((hcrc->Width == 32) && hcrc->refIn && crc32_HwCalc((uint32_t)_Poly, &_CRC, _data, _dataLength))
+    {
+        return _CRC;
+    };
+#endif
+
+    if(hcrc->Width <= 32)
+    {
+        return crc32_RegBits((uint32_t)_Poly, hcrc->Width, hcrc->refIn, (uint32_t)_Reg, _data, _dataLength);
+    };
+
+    return crcN_RegBits(_Poly, hcrc->Width, hcrc->refIn, _Reg, _data, _dataLength);
+};
+
+
+/**
+ * @brief Runs a generic CRC register through the byte table
+ * @param htable Pointer to generic CRC table context
+ * @param _Reg CRC register before the data
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t CRC register after the data
+ */
+static uint64_t crcN_TableUpdate(hcrcNTable_T *htable, uint64_t _Reg, const uint8_t *_data, size_t _dataLength)
+{
+#if ERR_HW_CRC
+    uint32_t _CRC = (uint32_t)_Reg;
+
+    if((htable->Config.Width == 32) && htable->Config.refIn && crc32_HwCalc((uint32_t)htable->Config.Poly, &_CRC, _data, _dataLength))
+    {
+        return _CRC;
+    };
+#endif
+
+    return crcN_RegTable(htable->Table, htable->Config.Width, htable->Config.refIn, _Reg, _data, _dataLength);
+};
+
+
+/**
+ * @brief Calculates a CRC of any width from 3 to 64 bits
+ * @param hcrc Pointer to generic CRC configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t Calculated CRC value (low Width bits)
+ * 
+ * @note Same model as CRC8/16/32_Calc: every input byte reflected when
+ *       refIn is set, MSB-first register, xorOut applied before the
+ *       output reflection.
+ */
+uint64_t CRCN_Calc(hcrcN_T *hcrc, uint8_t *_data, size_t _dataLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRCN, _dataLength);
+
+    return ERR_STATS_END(ERR_ALGO_CRCN, ERR_KERNEL_BITWISE, crcN_Final(hcrc, crcN_BitUpdate(hcrc, crcN_Start(hcrc), _data, _dataLength)));
+};
+
+
+/**
+ * @brief Builds the lookup table of a generic CRC configuration
+ * @param htable Pointer to generic CRC table context to fill
+ * @param hcrc Pointer to generic CRC configuration structure
+ * 
+ * @note MSB-first entries are stored aligned to the top of the 64-bit
+ *       word, so one table loop serves every width, including those
+ *       below 8 bits.
+ */
+void CRCN_TableInit(hcrcNTable_T *htable, hcrcN_T *hcrc)
+{
+    htable->Config = *hcrc;
+    crcN_RegBuild(htable->Table, hcrc->Poly & crcN_Mask(hcrc->Width), hcrc->Width, hcrc->refIn);
+};
+
+
+/**
+ * @brief Calculates a CRC of any width using a lookup table
+ * @param htable Pointer to generic CRC table context built by CRCN_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t Calculated CRC value (same as CRCN_Calc)
+ */
+uint64_t CRCN_TableCalc(hcrcNTable_T *htable, uint8_t *_data, size_t _dataLength)
+{
+    uint64_t _Reg = crcN_Start(&htable->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRCN, _dataLength);
+
+    _Reg = crcN_TableUpdate(htable, _Reg, _data, _dataLength);
+
+    return ERR_STATS_END(ERR_ALGO_CRCN, ERR_KERNEL_TABLE, crcN_Final(&htable->Config, _Reg));
+};
+
+/**
+ * @brief Builds the nibble table of a generic CRC configuration
+ * @param hnibble Pointer to generic CRC nibble table context to fill
+ * @param hcrc Pointer to generic CRC configuration structure
+ */
+void CRCN_NibbleInit(hcrcNNibble_T *hnibble, hcrcN_T *hcrc)
+{
+    hnibble->Config = *hcrc;
+    crcN_RegNibbleBuild(hnibble->Table, hcrc->Poly & crcN_Mask(hcrc->Width), hcrc->Width, hcrc->refIn);
+};
+
+
+/**
+ * @brief Calculates a CRC of any width with two 16-entry table lookups per byte
+ * @param hnibble Pointer to generic CRC nibble table context built by CRCN_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t Calculated CRC value (same as CRCN_Calc)
+ */
+uint64_t CRCN_NibbleCalc(hcrcNNibble_T *hnibble, uint8_t *_data, size_t _dataLength)
+{
+    uint64_t _Reg = crcN_Start(&hnibble->Config);
+    ERR_STATS_BEGIN(ERR_ALGO_CRCN, _dataLength);
+
+    _Reg = crcN_RegNibble(hnibble->Table, hnibble->Config.Width, hnibble->Config.refIn, _Reg, _data, _dataLength);
+
+    return ERR_STATS_END(ERR_ALGO_CRCN, ERR_KERNEL_NIBBLE, crcN_Final(&hnibble->Config, _Reg));
+};
+
+
+/**
+ * @brief Starts a streaming generic CRC calculation with the bitwise engine
+ * @param hctx Pointer to generic CRC streaming context to initialize
+ * @param hcrc Pointer to generic CRC configuration structure (must stay valid)
+ */
+void CRCN_Init(hcrcNCtx_T *hctx, hcrcN_T *hcrc)
+{
+    hctx->hcrc = hcrc;
+    hctx->htable = NULL;
+    hctx->Reg = crcN_Start(hcrc);
+};
+
+
+/**
+ * @brief Starts a streaming generic CRC calculation with the table engine
+ * @param hctx Pointer to generic CRC streaming context to initialize
+ * @param htable Pointer to table context built by CRCN_TableInit (must stay valid)
+ */
+void CRCN_InitTable(hcrcNCtx_T *hctx, hcrcNTable_T *htable)
+{
+    hctx->hcrc = &htable->Config;
+    hctx->htable = htable;
+    hctx->Reg = crcN_Start(&htable->Config);
+};
+
+
+/**
+ * @brief Feeds the next fragment into a streaming generic CRC calculation
+ * @param hctx Pointer to generic CRC streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void CRCN_Update(hcrcNCtx_T *hctx, uint8_t *_data, size_t _dataLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRCN, _dataLength);
+
+    if(hctx->htable != NULL)
+    {
+        hctx->Reg = crcN_TableUpdate(hctx->htable, hctx->Reg, _data, _dataLength);
+    }
+    else
+    {
+        hctx->Reg = crcN_BitUpdate(hctx->hcrc, hctx->Reg, _data, _dataLength);
+    };
+
+    ERR_STATS_DONE(ERR_ALGO_CRCN, (hctx->htable != NULL) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE);
+};
+
+
+/**
+ * @brief Returns the generic CRC of all fragments fed so far
+ * @param hctx Pointer to generic CRC streaming context
+ * @return uint64_t Final CRC value (xorOut and refOut applied)
+ */
+uint64_t CRCN_Final(hcrcNCtx_T *hctx)
+{
+    return crcN_Final(hctx->hcrc, hctx->Reg);
+};
+
+
+
+/**
+ * @brief Calculates 8-bit CRC value of a chain of buffer segments
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * @return uint8_t Same value as CRC8_Calc over the concatenated segments
+ * 
+ * @note Runs on the cached table of the configuration, like CRC8_CachedCalc,
+ *       and falls back to the bitwise engine when the cache is full or
+ *       disabled.
+ */
+uint8_t CRC8_CalcSG(hcrc8_T *hcrc, errBuffer_T *_segments, size_t _count)
+{
+    hcrc8Ctx_T _ctx;
+
+    CRC8_InitCached(&_ctx, hcrc);
+    CRC8_UpdateSG(&_ctx, _segments, _count);
+
+    return CRC8_Final(&_ctx);
+};
+
+
+/**
+ * @brief Calculates 16-bit CRC value of a chain of buffer segments
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * @return uint16_t Same value as CRC16_Calc over the concatenated segments
+ * 
+ * @note Runs on the cached table of the configuration, like CRC16_CachedCalc,
+ *       and falls back to the bitwise engine when the cache is full or
+ *       disabled.
+ */
+uint16_t CRC16_CalcSG(hcrc16_T *hcrc, errBuffer_T *_segments, size_t _count)
+{
+    hcrc16Ctx_T _ctx;
+
+    CRC16_InitCached(&_ctx, hcrc);
+    CRC16_UpdateSG(&_ctx, _segments, _count);
+
+    return CRC16_Final(&_ctx);
+};
+
+
+/**
+ * @brief Calculates 32-bit CRC value of a chain of buffer segments
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * @return uint32_t Same value as CRC32_Calc over the concatenated segments
+ * 
+ * @note Runs on the cached table of the configuration, like CRC32_CachedCalc,
+ *       and falls back to the bitwise engine when the cache is full or
+ *       disabled.
+ */
+uint32_t CRC32_CalcSG(hcrc32_T *hcrc, errBuffer_T *_segments, size_t _count)
+{
+    hcrc32Ctx_T _ctx;
+
+    CRC32_InitCached(&_ctx, hcrc);
+    CRC32_UpdateSG(&_ctx, _segments, _count);
+
+    return CRC32_Final(&_ctx);
+};
+
+
+/**
+ * @brief Calculates 8-bit checksum of a chain of buffer segments
+ * @param _segments Pointer to array of segment descriptors
+ * @param _count Number of segments
+ * @return uint8_t Same value as checkSum8_Calc over the concatenated segments
+ * 
+ * @note The checksum is a plain modular sum, so segment sums just add up.
+ */
+uint8_t checkSum8_CalcSG(errBuffer_T *_segments, size_t _count)
+{
+    uint8_t _checkSum = 0x00;
+
+    for(; _count > 0; _count--, _segments++)
+    {
+        _checkSum += checkSum8_CalcLarge(_segments->Data, _segments->Length);
+    };
+
+    return _checkSum;
+};
+
+
+/**
+ * @brief Calculates 16-bit checksum of a chain of buffer segments
+ * @param _segments Pointer to array of segment descriptors
+ * @param _count Number of segments
+ * @return uint16_t Same value as checkSum16_Calc over the concatenated segments
+ * 
+ * @note The checksum is a plain modular sum, so segment sums just add up.
+ */
+uint16_t checkSum16_CalcSG(errBuffer_T *_segments, size_t _count)
+{
+    uint16_t _checkSum = 0x00;
+
+    for(; _count > 0; _count--, _segments++)
+    {
+        _checkSum += checkSum16_CalcLarge(_segments->Data, _segments->Length);
+    };
+
+    return _checkSum;
+};
+
+
+/**
+ * @brief Calculates 32-bit checksum of a chain of buffer segments
+ * @param _segments Pointer to array of segment descriptors
+ * @param _count Number of segments
+ * @return uint32_t Same value as checkSum32_Calc over the concatenated segments
+ * 
+ * @note The checksum is a plain modular sum, so segment sums just add up.
+ */
+uint32_t checkSum32_CalcSG(errBuffer_T *_segments, size_t _count)
+{
+    uint32_t _checkSum = 0x00;
+
+    for(; _count > 0; _count--, _segments++)
+    {
+        _checkSum += checkSum32_CalcLarge(_segments->Data, _segments->Length);
+    };
+
+    return _checkSum;
+};
+
+
+/**
+ * @brief Merges the CRC8 values of two adjacent blocks
+ * @param _crcA CRC8_Calc result of the first block
+ * @param _crcB CRC8_Calc result of the second block
+ * @param _lengthB Length of the second block in bytes
+ * @param hcrc Pointer to CRC8 configuration used for both blocks
+ * @return uint8_t Same value as CRC8_Calc over block A followed by block B
+ */
+uint8_t CRC8_Combine(uint8_t _crcA, uint8_t _crcB, size_t _lengthB, hcrc8_T *hcrc)
+{
+    return (uint8_t) crc_Combine(_crcA, _crcB, _lengthB, hcrc->Poly, hcrc->Init, hcrc->refOut, hcrc->xorOut, 8);
+};
+
+
+/**
+ * @brief Merges the CRC16 values of two adjacent blocks
+ * @param _crcA CRC16_Calc result of the first block
+ * @param _crcB CRC16_Calc result of the second block
+ * @param _lengthB Length of the second block in bytes
+ * @param hcrc Pointer to CRC16 configuration used for both blocks
+ * @return uint16_t Same value as CRC16_Calc over block A followed by block B
+ */
+uint16_t CRC16_Combine(uint16_t _crcA, uint16_t _crcB, size_t _lengthB, hcrc16_T *hcrc)
+{
+    return (uint16_t) crc_Combine(_crcA, _crcB, _lengthB, hcrc->Poly, hcrc->Init, hcrc->refOut, hcrc->xorOut, 16);
+};
+
+
+/**
+ * @brief Merges the CRC32 values of two adjacent blocks
+ * @param _crcA CRC32_Calc result of the first block
+ * @param _crcB CRC32_Calc result of the second block
+ * @param _lengthB Length of the second block in bytes
+ * @param hcrc Pointer to CRC32 configuration used for both blocks
+ * @return uint32_t Same value as CRC32_Calc over block A followed by block B
+ * 
+ * @note The cost grows with log2(_lengthB) only (a few thousand bit steps for
+ *       any block size), so blocks can be computed on separate cores or DMA
+ *       channels and merged afterwards.
+ */
+uint32_t CRC32_Combine(uint32_t _crcA, uint32_t _crcB, size_t _lengthB, hcrc32_T *hcrc)
+{
+    return crc_Combine(_crcA, _crcB, _lengthB, hcrc->Poly, hcrc->Init, hcrc->refOut, hcrc->xorOut, 32);
+};
+
+
+/**
+ * @brief Updates an 8-bit checksum after a span of the data was rewritten in place
+ * @param _sum checkSum8_Calc result of the original data
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @return uint8_t Same value as checkSum8_Calc over the modified data
+ * 
+ * @note The sum does not depend on byte positions, so no offset is needed.
+ */
+uint8_t checkSum8_Patch(uint8_t _sum, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength)
+{
+    size_t _index = 0x00;
+
+    for(_index = 0; _index < _dataLength; _index++)
+    {
+        _sum = (uint8_t)(_sum - _oldData[_index] + _newData[_index]);
+    };
+
+    return _sum;
+};
+
+
+/**
+ * @brief Updates an 16-bit checksum after a span of the data was rewritten in place
+ * @param _sum checkSum16_Calc result of the original data
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @return uint16_t Same value as checkSum16_Calc over the modified data
+ * 
+ * @note The sum does not depend on byte positions, so no offset is needed.
+ */
+uint16_t checkSum16_Patch(uint16_t _sum, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength)
+{
+    size_t _index = 0x00;
+
+    for(_index = 0; _index < _dataLength; _index++)
+    {
+        _sum = (uint16_t)(_sum - _oldData[_index] + _newData[_index]);
+    };
+
+    return _sum;
+};
+
+
+/**
+ * @brief Updates an 32-bit checksum after a span of the data was rewritten in place
+ * @param _sum checkSum32_Calc result of the original data
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @return uint32_t Same value as checkSum32_Calc over the modified data
+ * 
+ * @note The sum does not depend on byte positions, so no offset is needed.
+ */
+uint32_t checkSum32_Patch(uint32_t _sum, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength)
+{
+    size_t _index = 0x00;
+
+    for(_index = 0; _index < _dataLength; _index++)
+    {
+        _sum = (uint32_t)(_sum - _oldData[_index] + _newData[_index]);
+    };
+
+    return _sum;
+};
+
+
+/**
+ * @brief Updates a CRC8 value after a span of the frame was rewritten in place
+ * @param _CRC CRC8_Calc result of the original frame
+ * @param _frameLength Length of the whole frame in bytes (the CRC covers all of it)
+ * @param _offset Offset of the rewritten span in the frame
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @return uint8_t Same value as CRC8_Calc over the modified frame
+ * 
+ * @note Costs one bitwise step per changed byte plus about 2*log2 of the
+ *       distance to the end of the frame, instead of a pass over the frame.
+ *       _offset + _dataLength must not exceed _frameLength.
+ */
+uint8_t CRC8_Patch(uint8_t _CRC, size_t _frameLength, size_t _offset, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength, hcrc8_T *hcrc)
+{
+    return (uint8_t) crc_Patch(_CRC, _oldData, _newData, _dataLength, _frameLength - _offset - _dataLength, hcrc->Poly, hcrc->refIn, hcrc->refOut, 8);
+};
+
+
+/**
+ * @brief Updates a CRC16 value after a span of the frame was rewritten in place
+ * @param _CRC CRC16_Calc result of the original frame
+ * @param _frameLength Length of the whole frame in bytes (the CRC covers all of it)
+ * @param _offset Offset of the rewritten span in the frame
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @return uint16_t Same value as CRC16_Calc over the modified frame
+ * 
+ * @note Costs one bitwise step per changed byte plus about 2*log2 of the
+ *       distance to the end of the frame, instead of a pass over the frame.
+ *       _offset + _dataLength must not exceed _frameLength.
+ */
+uint16_t CRC16_Patch(uint16_t _CRC, size_t _frameLength, size_t _offset, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength, hcrc16_T *hcrc)
+{
+    return (uint16_t) crc_Patch(_CRC, _oldData, _newData, _dataLength, _frameLength - _offset - _dataLength, hcrc->Poly, hcrc->refIn, hcrc->refOut, 16);
+};
+
+
+/**
+ * @brief Updates a CRC32 value after a span of the frame was rewritten in place
+ * @param _CRC CRC32_Calc result of the original frame
+ * @param _frameLength Length of the whole frame in bytes (the CRC covers all of it)
+ * @param _offset Offset of the rewritten span in the frame
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @return uint32_t Same value as CRC32_Calc over the modified frame
+ * 
+ * @note Costs one bitwise step per changed byte plus about 2*log2 of the
+ *       distance to the end of the frame, instead of a pass over the frame.
+ *       _offset + _dataLength must not exceed _frameLength.
+ */
+uint32_t CRC32_Patch(uint32_t _CRC, size_t _frameLength, size_t _offset, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength, hcrc32_T *hcrc)
+{
+    return crc_Patch(_CRC, _oldData, _newData, _dataLength, _frameLength - _offset - _dataLength, hcrc->Poly, hcrc->refIn, hcrc->refOut, 32);
+};
+
+
+/**
+ * @brief Hash slot of a syndrome in an error-correction table
+ */
+static size_t crcFix_Slot(uint32_t _syndrome, size_t _count)
+{
+    return (size_t)((uint32_t)(_syndrome * 0x9E3779B1UL) % _count);
+};
+
+
+/**
+ * @brief Adds a syndrome to an error-correction table
+ * @param _entries Pointer to hash table
+ * @param _count Number of entries in the hash table
+ * @param _syndrome Register difference caused by the error
+ * @param _position First flipped bit (shift order) or ERR_FIX_TRAILER
+ * @param _pattern Flipped bits from _position on
+ * 
+ * @note A syndrome reached by two different errors is marked ERR_FIX_AMBIGUOUS,
+ *       so it is reported as uncorrectable instead of being miscorrected.
+ *       Zero syndromes are undetectable errors and are not stored.
+ */
+static void crcFix_Insert(hcrcFixEntry_T *_entries, size_t _count, uint32_t _syndrome, uint16_t _position, uint8_t _pattern)
+{
+    size_t _slot = crcFix_Slot(_syndrome, _count);
+
+    if(_syndrome == 0)
+    {
+        return;
+    };
+
+    while(_entries[_slot].Pattern != 0)
+    {
+        if(_entries[_slot].Syndrome == _syndrome)
+        {
+            _entries[_slot].Position = ERR_FIX_AMBIGUOUS;
+            return;
+        };
+        _slot = (_slot + 1 == _count) ? 0 : _slot + 1;
+    };
+
+    _entries[_slot].Syndrome = _syndrome;
+    _entries[_slot].Position = _position;
+    _entries[_slot].Pattern = _pattern;
+};
+
+
+/**
+ * @brief Builds the syndrome table for every correctable error of a frame length
+ * @param _entries Pointer to hash table
+ * @param _count Number of entries in the hash table
+ * @param _Poly CRC polynomial (MSB-first form)
+ * @param _width CRC width in bits (16 or 32)
+ * @param _payloadLength Payload length in bytes
+ * @param _burst Longest correctable burst in bits (1 to 8)
+ * @return bool true when built, false for invalid parameters or too few entries
+ * 
+ * @note A flipped payload bit t (shift order, N payload bits) changes the
+ *       register by x^(width + N - 1 - t) mod P, the operator CRCxx_Combine and
+ *       CRCxx_Patch apply. Walking t from the end multiplies the previous
+ *       value by x, so the whole table costs one register step per entry.
+ *       A burst is the XOR of the values of its bits. Single-bit errors in
+ *       the CRC field change the register by one bit (ERR_FIX_TRAILER).
+ */
+static bool crcFix_Build(hcrcFixEntry_T *_entries, size_t _count, uint32_t _Poly, uint8_t _width, size_t _payloadLength, uint8_t _burst)
+{
+    uint32_t _mask = (uint32_t)((((uint64_t)1) << _width) - 1);
+    uint32_t _topBit = (uint32_t)1 << (_width - 1);
+    uint32_t _window[8] = {0};
+    uint32_t _syndrome = 0x00;
+    size_t _bits = 8 * _payloadLength;
+    size_t _position = 0x00;
+    size_t _index = 0x00;
+    uint16_t _pattern = 0x00;
+    uint8_t _bitIndex = 0x00;
+
+    if((_burst < 1) || (_burst > 8) || (_payloadLength > 8190) || (_count < ERR_FIX_ENTRIES(_payloadLength, _width, _burst)))
+    {
+        return false;
+    };
+
+    for(_index = 0; _index < _count; _index++)
+    {
+        _entries[_index].Pattern = 0x00;
+    };
+
+    for(_bitIndex = 0; _bitIndex < _width; _bitIndex++)
+    {
+        crcFix_Insert(_entries, _count, (uint32_t)1 << _bitIndex, ERR_FIX_TRAILER, 0x01);
+    };
+
+    /* _window[k] holds the syndrome of payload bit _position + k */
+    _window[0] = _Poly & _mask;
+    for(_position = _bits; _position > 0; )
+    {
+        _position--;
+        if(_position != _bits - 1)
+        {
+            for(_bitIndex = 7; _bitIndex > 0; _bitIndex--)
+            {
+                _window[_bitIndex] = _window[_bitIndex - 1];
+            };
+            _window[0] = (_window[0] & _topBit) ? (((_window[0] << 1) ^ _Poly) & _mask) : ((_window[0] << 1) & _mask);
+        };
+
+        for(_pattern = 0x01; _pattern < ((uint16_t)1 << _burst); _pattern += 2)
+        {
+            _syndrome = 0x00;
+            for(_bitIndex = 0; _bitIndex < 8; _bitIndex++)
+            {
+                if(bitCheckHigh(_pattern, _bitIndex))
+                {
+                    if(_position + _bitIndex >= _bits)
+                    {
+                        break;
+                    };
+                    _syndrome ^= _window[_bitIndex];
+                };
+            };
+            if(_bitIndex == 8)
+            {
+                crcFix_Insert(_entries, _count, _syndrome, (uint16_t)_position, (uint8_t)_pattern);
+            };
+        };
+    };
+
+    return true;
+};
+
+
+/**
+ * @brief Reads a CRC trailer in the given byte order
+ */
+static uint32_t crcFix_Load(const uint8_t *_trailer, uint8_t _bytes, errEndian_T _endian)
+{
+    uint32_t _value = 0x00;
+    uint8_t _index = 0x00;
+
+    for(_index = 0; _index < _bytes; _index++)
+    {
+        _value = (_value << 8) | _trailer[(_endian == ERR_ENDIAN_BIG) ? _index : (_bytes - 1 - _index)];
+    };
+
+    return _value;
+};
+
+
+/**
+ * @brief Locates and fixes the error of a syndrome
+ * @param _entries Pointer to hash table built by crcFix_Build
+ * @param _count Number of entries in the hash table
+ * @param _syndrome MSB-first difference between computed and stored CRC
+ * @param _frame Pointer to payload followed by the CRC
+ * @param _payloadLength Payload length in bytes
+ * @param _bytes CRC size in bytes
+ * @param _CRC CRC computed over the received payload
+ * @param _refIn Input reflection of the configuration (bit order inside the bytes)
+ * @param _endian Byte order of the CRC trailer
+ * @return errFix_T Result of the correction
+ */
+static errFix_T crcFix_Correct(const hcrcFixEntry_T *_entries, size_t _count, uint32_t _syndrome, uint8_t *_frame, size_t _payloadLength, uint8_t _bytes, uint32_t _CRC, bool _refIn, errEndian_T _endian)
+{
+    size_t _slot = crcFix_Slot(_syndrome, _count);
+    size_t _bit = 0x00;
+    uint8_t _index = 0x00;
+
+    if(_syndrome == 0)
+    {
+        return ERR_FIX_NONE;
+    };
+
+    while((_entries[_slot].Pattern != 0) && (_entries[_slot].Syndrome != _syndrome))
+    {
+        _slot = (_slot + 1 == _count) ? 0 : _slot + 1;
+    };
+
+    if((_entries[_slot].Pattern == 0) || (_entries[_slot].Position == ERR_FIX_AMBIGUOUS))
+    {
+        return ERR_FIX_FAILED;
+    };
+
+    if(_entries[_slot].Position == ERR_FIX_TRAILER)
+    {
+        for(_index = 0; _index < _bytes; _index++)
+        {
+            _frame[_payloadLength + ((_endian == ERR_ENDIAN_BIG) ? (_bytes - 1 - _index) : _index)] = (uint8_t)(_CRC >> (8 * _index));
+        };
+        return ERR_FIX_CORRECTED;
+    };
+
+    for(_index = 0; _index < 8; _index++)
+    {
+        if(bitCheckHigh(_entries[_slot].Pattern, _index))
+        {
+            _bit = (size_t)_entries[_slot].Position + _index;
+            _frame[_bit >> 3] ^= (uint8_t)(_refIn ? (0x01 << (_bit & 0x07)) : (0x80 >> (_bit & 0x07)));
+        };
+    };
+
+    return ERR_FIX_CORRECTED;
+};
+
+
+/**
+ * @brief Builds the syndrome table of the CRC16 error-correction mode
+ * @param hfix Pointer to error-correction context
+ * @param htable Pointer to CRC16 table context of the link (must stay valid)
+ * @param _frameLength Length of payload plus 2-byte CRC in bytes (payload up to 8190 bytes)
+ * @param _burst Longest correctable burst in bits (1 to 8, 1 = single-bit errors only)
+ * @param _entries Storage for the syndrome hash table (must stay valid)
+ * @param _count Number of entries, at least ERR_FIX_ENTRIES(_frameLength - 2, 16, _burst)
+ * @return bool true when built, false for invalid parameters or too few entries
+ * 
+ * @note Build it once per frame length: one register step per entry, about
+ *       8 * payload * 2^(_burst - 1) entries of 8 bytes.
+ */
+bool CRC16_FixInit(hcrc16Fix_T *hfix, hcrc16Table_T *htable, size_t _frameLength, uint8_t _burst, hcrcFixEntry_T *_entries, size_t _count)
+{
+    if(_frameLength < 2)
+    {
+        return false;
+    };
+
+    hfix->htable = htable;
+    hfix->FrameLength = _frameLength;
+    hfix->Entries = _entries;
+    hfix->Count = _count;
+
+    return crcFix_Build(_entries, _count, htable->Config.Poly, 16, _frameLength - 2, _burst);
+};
+
+
+/**
+ * @brief Verifies a frame that ends with its CRC16 and corrects a single error in place
+ * @param hfix Pointer to error-correction context built by CRC16_FixInit
+ * @param _frame Pointer to payload followed by the 2-byte CRC (FrameLength bytes)
+ * @param _endian Byte order of the CRC trailer
+ * @return errFix_T ERR_FIX_NONE, ERR_FIX_CORRECTED or ERR_FIX_FAILED
+ * 
+ * @note The syndrome (computed CRC ^ stored CRC, with refOut undone; xorOut
+ *       and Init cancel out) is looked up in the hash table, so locating the
+ *       error costs O(1) after the usual CRC pass instead of one CRC pass
+ *       per candidate bit. Corrects one single-bit error anywhere in the
+ *       frame or one burst of up to _burst bits inside the payload; an
+ *       error outside that set may be miscorrected once it exceeds the
+ *       error-detecting power of the polynomial for this frame length.
+ */
+errFix_T CRC16_Fix(hcrc16Fix_T *hfix, uint8_t *_frame, errEndian_T _endian)
+{
+    size_t _payloadLength = hfix->FrameLength - 2;
+    uint16_t _CRC = CRC16_TableCalc(hfix->htable, _frame, _payloadLength);
+    uint32_t _syndrome = _CRC ^ crcFix_Load(_frame + _payloadLength, 2, _endian);
+
+    if(hfix->htable->Config.refOut)
+    {
+        _syndrome = bitReflected(_syndrome, 16);
+    };
+
+    return crcFix_Correct(hfix->Entries, hfix->Count, _syndrome, _frame, _payloadLength, 2, _CRC, hfix->htable->Config.refIn, _endian);
+};
+
+
+/**
+ * @brief Builds the syndrome table of the CRC32 error-correction mode
+ * @param hfix Pointer to error-correction context
+ * @param htable Pointer to CRC32 table context of the link (must stay valid)
+ * @param _frameLength Length of payload plus 4-byte CRC in bytes (payload up to 8190 bytes)
+ * @param _burst Longest correctable burst in bits (1 to 8, 1 = single-bit errors only)
+ * @param _entries Storage for the syndrome hash table (must stay valid)
+ * @param _count Number of entries, at least ERR_FIX_ENTRIES(_frameLength - 4, 32, _burst)
+ * @return bool true when built, false for invalid parameters or too few entries
+ * 
+ * @note Build it once per frame length: one register step per entry, about
+ *       8 * payload * 2^(_burst - 1) entries of 8 bytes.
+ */
+bool CRC32_FixInit(hcrc32Fix_T *hfix, hcrc32Table_T *htable, size_t _frameLength, uint8_t _burst, hcrcFixEntry_T *_entries, size_t _count)
+{
+    if(_frameLength < 4)
+    {
+        return false;
+    };
+
+    hfix->htable = htable;
+    hfix->FrameLength = _frameLength;
+    hfix->Entries = _entries;
+    hfix->Count = _count;
+
+    return crcFix_Build(_entries, _count, htable->Config.Poly, 32, _frameLength - 4, _burst);
+};
+
+
+/**
+ * @brief Verifies a frame that ends with its CRC32 and corrects a single error in place
+ * @param hfix Pointer to error-correction context built by CRC32_FixInit
+ * @param _frame Pointer to payload followed by the 4-byte CRC (FrameLength bytes)
+ * @param _endian Byte order of the CRC trailer
+ * @return errFix_T ERR_FIX_NONE, ERR_FIX_CORRECTED or ERR_FIX_FAILED
+ * 
+ * @note The syndrome (computed CRC ^ stored CRC, with refOut undone; xorOut
+ *       and Init cancel out) is looked up in the hash table, so locating the
+ *       error costs O(1) after the usual CRC pass instead of one CRC pass
+ *       per candidate bit. Corrects one single-bit error anywhere in the
+ *       frame or one burst of up to _burst bits inside the payload; an
+ *       error outside that set may be miscorrected once it exceeds the
+ *       error-detecting power of the polynomial for this frame length.
+ */
+errFix_T CRC32_Fix(hcrc32Fix_T *hfix, uint8_t *_frame, errEndian_T _endian)
+{
+    size_t _payloadLength = hfix->FrameLength - 4;
+    uint32_t _CRC = CRC32_TableCalc(hfix->htable, _frame, _payloadLength);
+    uint32_t _syndrome = _CRC ^ crcFix_Load(_frame + _payloadLength, 4, _endian);
+
+    if(hfix->htable->Config.refOut)
+    {
+        _syndrome = bitReflected(_syndrome, 32);
+    };
+
+    return crcFix_Correct(hfix->Entries, hfix->Count, _syndrome, _frame, _payloadLength, 4, _CRC, hfix->htable->Config.refIn, _endian);
+};
+
+/**
+ * @brief Verifies a frame that ends with its CRC8
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _frame Pointer to payload followed by the 1-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @return bool true when the trailing CRC matches the payload
+ * 
+ * @note The payload is run through the CRC once and the trailer is checked
+ *       against the residue of the configuration, so no separate compare
+ *       pass or final reflection is needed. Both use the cached table of the
+ *       configuration, or the bitwise engine when the cache is full.
+ */
+bool CRC8_Verify(hcrc8_T *hcrc, uint8_t *_frame, size_t _frameLength)
+{
+    hcrc8Table_T *htable = NULL;
+    ERR_STATS_BEGIN(ERR_ALGO_CRC8, _frameLength);
+
+    if(_frameLength < 1)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC8, ERR_KERNEL_BITWISE, false);
+    };
+
+    _frameLength -= 1;
+    htable = crc8_CacheGet(hcrc);
+
+    if(htable != NULL)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC8, ERR_KERNEL_TABLE, crc8_Residue(hcrc, htable->Table, crc8_TableUpdate(htable->Table, crc8_Start(hcrc), _frame, _frameLength), _frame + _frameLength));
+    };
+
+    return ERR_STATS_CHECK(ERR_ALGO_CRC8, ERR_KERNEL_BITWISE, crc8_Residue(hcrc, NULL, crc8_BitUpdate(hcrc, crc8_Start(hcrc), _frame, _frameLength), _frame + _frameLength));
+};
+
+
+/**
+ * @brief Verifies a frame that ends with its CRC8 using a lookup table
+ * @param htable Pointer to CRC8 table context built by CRC8_TableInit
+ * @param _frame Pointer to payload followed by the 1-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC8_TableVerify(hcrc8Table_T *htable, uint8_t *_frame, size_t _frameLength)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRC8, _frameLength);
+
+    if(_frameLength < 1)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC8, ERR_KERNEL_TABLE, false);
+    };
+
+    _frameLength -= 1;
+
+    return ERR_STATS_CHECK(ERR_ALGO_CRC8, ERR_KERNEL_TABLE, crc8_Residue(&htable->Config, htable->Table, crc8_TableUpdate(htable->Table, crc8_Start(&htable->Config), _frame, _frameLength), _frame + _frameLength));
+};
+
+
+/**
+ * @brief Verifies a frame that ends with its CRC16
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _frame Pointer to payload followed by the 2-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer (ERR_ENDIAN_LITTLE / ERR_ENDIAN_BIG)
+ * @return bool true when the trailing CRC matches the payload
+ * 
+ * @note The payload is run through the CRC once and the trailer is checked
+ *       against the residue of the configuration, so no separate compare
+ *       pass or final reflection is needed. Both use the cached table of the
+ *       configuration, or the bitwise engine when the cache is full.
+ */
+bool CRC16_Verify(hcrc16_T *hcrc, uint8_t *_frame, size_t _frameLength, errEndian_T _endian)
+{
+    hcrc16Table_T *htable = NULL;
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _frameLength);
+
+    if(_frameLength < 2)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC16, ERR_KERNEL_BITWISE, false);
+    };
+
+    _frameLength -= 2;
+    htable = crc16_CacheGet(hcrc);
+
+    if(htable != NULL)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC16, ERR_KERNEL_TABLE, crc16_Residue(hcrc, htable->Table, crc16_TableRun(htable, crc16_Start(hcrc), _frame, _frameLength), _frame + _frameLength, _endian));
+    };
+
+    return ERR_STATS_CHECK(ERR_ALGO_CRC16, ERR_KERNEL_BITWISE, crc16_Residue(hcrc, NULL, crc16_BitUpdate(hcrc, crc16_Start(hcrc), _frame, _frameLength), _frame + _frameLength, _endian));
+};
+
+
+/**
+ * @brief Verifies a frame that ends with its CRC16 using a lookup table
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit
+ * @param _frame Pointer to payload followed by the 2-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer (ERR_ENDIAN_LITTLE / ERR_ENDIAN_BIG)
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC16_TableVerify(hcrc16Table_T *htable, uint8_t *_frame, size_t _frameLength, errEndian_T _endian)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _frameLength);
+
+    if(_frameLength < 2)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC16, ERR_KERNEL_TABLE, false);
+    };
+
+    _frameLength -= 2;
+
+    return ERR_STATS_CHECK(ERR_ALGO_CRC16, ERR_KERNEL_TABLE, crc16_Residue(&htable->Config, htable->Table, crc16_TableRun(htable, crc16_Start(&htable->Config), _frame, _frameLength), _frame + _frameLength, _endian));
+};
+
+
+/**
+ * @brief Verifies a frame that ends with its CRC32
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _frame Pointer to payload followed by the 4-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer (ERR_ENDIAN_LITTLE / ERR_ENDIAN_BIG)
+ * @return bool true when the trailing CRC matches the payload
+ * 
+ * @note The payload is run through the CRC once and the trailer is checked
+ *       against the residue of the configuration, so no separate compare
+ *       pass or final reflection is needed. Both use the cached table of the
+ *       configuration, or the bitwise engine when the cache is full.
+ */
+bool CRC32_Verify(hcrc32_T *hcrc, uint8_t *_frame, size_t _frameLength, errEndian_T _endian)
+{
+    hcrc32Table_T *htable = NULL;
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _frameLength);
+
+    if(_frameLength < 4)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC32, ERR_KERNEL_BITWISE, false);
+    };
+
+    _frameLength -= 4;
+    htable = crc32_CacheGet(hcrc);
+
+    if(htable != NULL)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC32, ERR_KERNEL_TABLE, crc32_Residue(hcrc, htable->Table, crc32_TableRun(htable, crc32_Start(hcrc), _frame, _frameLength), _frame + _frameLength, _endian));
+    };
+
+    return ERR_STATS_CHECK(ERR_ALGO_CRC32, ERR_KERNEL_BITWISE, crc32_Residue(hcrc, NULL, crc32_BitUpdate(hcrc, crc32_Start(hcrc), _frame, _frameLength), _frame + _frameLength, _endian));
+};
+
+
+/**
+ * @brief Verifies a frame that ends with its CRC32 using a lookup table
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _frame Pointer to payload followed by the 4-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer (ERR_ENDIAN_LITTLE / ERR_ENDIAN_BIG)
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC32_TableVerify(hcrc32Table_T *htable, uint8_t *_frame, size_t _frameLength, errEndian_T _endian)
+{
+    ERR_STATS_BEGIN(ERR_ALGO_CRC32, _frameLength);
+
+    if(_frameLength < 4)
+    {
+        return ERR_STATS_CHECK(ERR_ALGO_CRC32, ERR_KERNEL_TABLE, false);
+    };
+
+    _frameLength -= 4;
+
+    return ERR_STATS_CHECK(ERR_ALGO_CRC32, ERR_KERNEL_TABLE, crc32_Residue(&htable->Config, htable->Table, crc32_TableRun(htable, crc32_Start(&htable->Config), _frame, _frameLength), _frame + _frameLength, _endian));
+};
+
+
+/**
+ * @brief Initializes a receive-and-verify pipeline for DMA double-buffered streams
+ * @param hpipe Pointer to pipeline context
+ * @param htable Pointer to CRC32 table context of the link (must stay valid)
+ * @param _frameLength Length of payload plus 4-byte CRC in bytes (at least 4)
+ * @param _endian Byte order of the CRC trailer
+ * @param _callback Function called with the result of every frame, or NULL
+ * @param _arg Argument passed to the callback
+ */
+void errPipe_Init(herrPipe_T *hpipe, hcrc32Table_T *htable, size_t _frameLength, errEndian_T _endian, errPipeCallback_T _callback, void *_arg)
+{
+    hpipe->htable = htable;
+    hpipe->FrameLength = _frameLength;
+    hpipe->Endian = _endian;
+    hpipe->Frames = 0x00;
+    hpipe->Errors = 0x00;
+    hpipe->Callback = _callback;
+    hpipe->Arg = _arg;
+    errPipe_Resync(hpipe);
+};
+
+
+/**
+ * @brief Feeds a received half-buffer into the pipeline
+ * @param hpipe Pointer to pipeline context
+ * @param _data Pointer to the half-buffer just filled by DMA
+ * @param _dataLength Length of the half-buffer in bytes
+ * 
+ * @note Call it from the DMA half-complete interrupt with the first half and
+ *       from the transfer-complete interrupt with the second half: the CRC
+ *       of one half runs while DMA fills the other, so verification ends
+ *       with the reception of the last byte. Frames may span halves and a
+ *       half may hold several frames. The payload goes through the table /
+ *       hardware engine, the trailer is checked with the CRC32_TableVerify
+ *       residue test. The CRC of a half must finish before DMA refills it.
+ */
+void errPipe_Feed(herrPipe_T *hpipe, uint8_t *_data, size_t _dataLength)
+{
+    size_t _payloadLength = hpipe->FrameLength - 4;
+    size_t _chunk = 0x00;
+    bool _valid = false;
+
+    while(_dataLength > 0)
+    {
+        if(hpipe->Position < _payloadLength)
+        {
+            _chunk = _payloadLength - hpipe->Position;
+            if(_chunk > _dataLength)
+            {
+                _chunk = _dataLength;
+            };
+            CRC32_Update(&hpipe->Ctx, _data, _chunk);
+        }
+        else
+        {
+            _chunk = 1;
+            hpipe->Trailer[hpipe->Position - _payloadLength] = *_data;
+        };
+
+        _data += _chunk;
+        _dataLength -= _chunk;
+        hpipe->Position += _chunk;
+
+        if(hpipe->Position == hpipe->FrameLength)
+        {
+            _valid = ERR_STATS_VERIFY(crc32_Residue(&hpipe->htable->Config, hpipe->htable->Table, hpipe->Ctx.Reg, hpipe->Trailer, hpipe->Endian));
+            if(!_valid)
+            {
+                hpipe->Errors++;
+            };
+            if(hpipe->Callback != NULL)
+            {
+                hpipe->Callback(hpipe->Arg, hpipe->Frames, _valid);
+            };
+            hpipe->Frames++;
+            errPipe_Resync(hpipe);
+        };
+    };
+};
+
+
+/**
+ * @brief Drops the partly received frame of a pipeline
+ * @param hpipe Pointer to pipeline context
+ * 
+ * @note Call it after a DMA error or when the link finds the start of a new
+ *       frame; the next byte fed is taken as the first byte of a frame.
+ */
+void errPipe_Resync(herrPipe_T *hpipe)
+{
+    CRC32_InitTable(&hpipe->Ctx, hpipe->htable);
+    hpipe->Position = 0x00;
+};
+
+
+/**
+ * @brief Calculates the CRC8 of many independent frames in one call
+ * @param htable Pointer to CRC8 table context built by CRC8_TableInit
+ * @param _frames Pointer to array of frame descriptors
+ * @param _results Pointer to array receiving one CRC per frame
+ * @param _count Number of frames
+ * 
+ * @note Frames are taken four at a time and run in lockstep over their
+ *       common length, then every frame finishes its own tail. Each result
+ *       equals CRC8_TableCalc of the same frame.
+ */
+void CRC8_BatchCalc(hcrc8Table_T *htable, errBuffer_T *_frames, uint8_t *_results, size_t _count)
+{
+    uint8_t _CRC[4];
+    const uint8_t *_lane[4];
+    size_t _common = 0x00;
+    uint8_t _laneIndex = 0x00;
+
+    for(; _count >= 4; _count -= 4, _frames += 4, _results += 4)
+    {
+        ERR_STATS_BEGIN(ERR_ALGO_CRC8, _frames[0].Length + _frames[1].Length + _frames[2].Length + _frames[3].Length);
+
+        _common = _frames[0].Length;
+        for(_laneIndex = 0; _laneIndex < 4; _laneIndex++)
+        {
+            _CRC[_laneIndex] = crc8_Start(&htable->Config);
+            _lane[_laneIndex] = _frames[_laneIndex].Data;
+            if(_frames[_laneIndex].Length < _common)
+            {
+                _common = _frames[_laneIndex].Length;
+            };
+        };
+
+        crc8_TableUpdate4(htable->Table, _CRC, _lane, _common);
+
+        for(_laneIndex = 0; _laneIndex < 4; _laneIndex++)
+        {
+            _CRC[_laneIndex] = crc8_TableUpdate(htable->Table, _CRC[_laneIndex], _lane[_laneIndex] + _common, _frames[_laneIndex].Length - _common);
+            _results[_laneIndex] = crc8_Final(&htable->Config, _CRC[_laneIndex]);
+        };
+
+        ERR_STATS_DONE(ERR_ALGO_CRC8, ERR_KERNEL_TABLE);
+    };
+
+    for(; _count > 0; _count--, _frames++, _results++)
+    {
+        *_results = CRC8_TableCalc(htable, _frames->Data, _frames->Length);
+    };
+};
+
+
+/**
+ * @brief Calculates the CRC16 of many independent frames in one call
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit
+ * @param _frames Pointer to array of frame descriptors
+ * @param _results Pointer to array receiving one CRC per frame
+ * @param _count Number of frames
+ * 
+ * @note Frames are taken four at a time and run in lockstep over their
+ *       common length, then every frame finishes its own tail. Long tails
+ *       go through the fastest engine of the table context. Each result
+ *       equals CRC16_TableCalc of the same frame.
+ */
+void CRC16_BatchCalc(hcrc16Table_T *htable, errBuffer_T *_frames, uint16_t *_results, size_t _count)
+{
+    uint16_t _CRC[4];
+    const uint8_t *_lane[4];
+    size_t _common = 0x00;
+    uint8_t _laneIndex = 0x00;
+
+    for(; _count >= 4; _count -= 4, _frames += 4, _results += 4)
+    {
+        ERR_STATS_BEGIN(ERR_ALGO_CRC16, _frames[0].Length + _frames[1].Length + _frames[2].Length + _frames[3].Length);
+
+        _common = _frames[0].Length;
+        for(_laneIndex = 0; _laneIndex < 4; _laneIndex++)
+        {
+            _CRC[_laneIndex] = crc16_Start(&htable->Config);
+            _lane[_laneIndex] = _frames[_laneIndex].Data;
+            if(_frames[_laneIndex].Length < _common)
+            {
+                _common = _frames[_laneIndex].Length;
+            };
+        };
+
+        crc16_TableUpdate4(htable->Table, htable->Config.refIn, _CRC, _lane, _common);
+
+        for(_laneIndex = 0; _laneIndex < 4; _laneIndex++)
+        {
+            _CRC[_laneIndex] = crc16_TableRun(htable, _CRC[_laneIndex], _lane[_laneIndex] + _common, _frames[_laneIndex].Length - _common);
+            _results[_laneIndex] = crc16_Final(&htable->Config, _CRC[_laneIndex]);
+        };
+
+        ERR_STATS_DONE(ERR_ALGO_CRC16, ERR_KERNEL_TABLE);
+    };
+
+    for(; _count > 0; _count--, _frames++, _results++)
+    {
+        *_results = CRC16_TableCalc(htable, _frames->Data, _frames->Length);
+    };
+};
+
+
+/**
+ * @brief Calculates the CRC32 of many independent frames in one call
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _frames Pointer to array of frame descriptors
+ * @param _results Pointer to array receiving one CRC per frame
+ * @param _count Number of frames
+ * 
+ * @note Frames are taken four at a time and run in lockstep over their
+ *       common length, then every frame finishes its own tail. Long tails
+ *       go through the fastest engine of the table context. Each result
+ *       equals CRC32_TableCalc of the same frame.
+ *       Configurations handled by the CRC instructions (ERR_HW_CRC) are
+ *       computed frame by frame in hardware instead.
+ */
+void CRC32_BatchCalc(hcrc32Table_T *htable, errBuffer_T *_frames, uint32_t *_results, size_t _count)
+{
+    uint32_t _CRC[4];
+    const uint8_t *_lane[4];
+    size_t _common = 0x00;
+    uint8_t _laneIndex = 0x00;
+
+#if ERR_HW_CRC
+    if(htable->Config.refIn && crc32_HwUsable(htable->Config.Poly))
+    {
+        for(; _count > 0; _count--, _frames++, _results++)
+        {
+            *_results = CRC32_TableCalc(htable, _frames->Data, _frames->Length);
+        };
+        return;
+    };
+#endif
+
+    for(; _count >= 4; _count -= 4, _frames += 4, _results += 4)
+    {
+        ERR_STATS_BEGIN(ERR_ALGO_CRC32, _frames[0].Length + _frames[1].Length + _frames[2].Length + _frames[3].Length);
+
+        _common = _frames[0].Length;
+        for(_laneIndex = 0; _laneIndex < 4; _laneIndex++)
+        {
+            _CRC[_laneIndex] = crc32_Start(&htable->Config);
+            _lane[_laneIndex] = _frames[_laneIndex].Data;
+            if(_frames[_laneIndex].Length < _common)
+            {
+                _common = _frames[_laneIndex].Length;
+            };
+        };
+
+        crc32_TableUpdate4(htable->Table, htable->Config.refIn, _CRC, _lane, _common);
+
+        for(_laneIndex = 0; _laneIndex < 4; _laneIndex++)
+        {
+            _CRC[_laneIndex] = crc32_TableRun(htable, _CRC[_laneIndex], _lane[_laneIndex] + _common, _frames[_laneIndex].Length - _common);
+            _results[_laneIndex] = crc32_Final(&htable->Config, _CRC[_laneIndex]);
+        };
+
+        ERR_STATS_DONE(ERR_ALGO_CRC32, ERR_KERNEL_TABLE);
+    };
+
+    for(; _count > 0; _count--, _frames++, _results++)
+    {
+        *_results = CRC32_TableCalc(htable, _frames->Data, _frames->Length);
+    };
+};
+
+
+/**
+ * @brief Starts a multi-stream CRC16 calculation
+ * @param hctx Pointer to CRC16 multi-stream context to initialize
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit (must stay valid)
+ * @param _configs Array of one configuration per lane (must stay valid), or
+ *                 NULL to use the table's configuration on every lane
+ * @param _lanes Number of lanes (1..ERR_MULTI_LANES)
+ * @return bool false when _lanes is out of range or a lane's Poly / refIn
+ *         differs from the table's
+ */
+bool CRC16_MultiInit(hcrc16Multi_T *hctx, hcrc16Table_T *htable, hcrc16_T **_configs, uint8_t _lanes)
+{
+    uint8_t _lane = 0x00;
+
+    if((_lanes == 0) || (_lanes > ERR_MULTI_LANES))
+    {
+        return false;
+    };
+
+    for(_lane = 0; _lane < _lanes; _lane++)
+    {
+        if((_configs != NULL) && ((_configs[_lane]->Poly != htable->Config.Poly) || (_configs[_lane]->refIn != htable->Config.refIn)))
+        {
+            return false;
+        };
+    };
+
+    hctx->htable = htable;
+    hctx->Lanes = _lanes;
+    for(_lane = 0; _lane < _lanes; _lane++)
+    {
+        hctx->hcrc[_lane] = (_configs != NULL) ? _configs[_lane] : &htable->Config;
+        hctx->Reg[_lane] = crc16_Start(hctx->hcrc[_lane]);
+    };
+
+    return true;
+};
+
+
+/**
+ * @brief Restarts one lane of a multi-stream CRC16 calculation
+ * @param hctx Pointer to CRC16 multi-stream context
+ * @param _lane Lane index
+ */
+void CRC16_MultiReset(hcrc16Multi_T *hctx, uint8_t _lane)
+{
+    hctx->Reg[_lane] = crc16_Start(hctx->hcrc[_lane]);
+};
+
+
+/**
+ * @brief Feeds the next fragment of every lane into a multi-stream CRC16 calculation
+ * @param hctx Pointer to CRC16 multi-stream context
+ * @param _fragments Array of one fragment per lane (lengths may differ, 0 skips the lane)
+ * 
+ * @note The lanes that still have data run in lockstep over their common
+ *       length, then the shortest drop out and the rest continue, so no
+ *       lane ever runs alone while others wait. Groups of four lanes share
+ *       the interleaved table loop (four independent lookup chains, which
+ *       keeps Cortex-M pipelines busy); on x86-64 hosts with SSSE3, five to
+ *       eight lanes with at least 16 common bytes run in one SSE register of
+ *       eight 16-bit lanes. That pass takes less time than two table
+ *       groups, but more than a single one. Unused slots of a group repeat
+ *       its first lane and their results are dropped. With ERR_STATS the
+ *       call is counted as ERR_KERNEL_SIMD when the SSE pass ran, and as
+ *       ERR_KERNEL_TABLE otherwise.
+ */
+void CRC16_MultiUpdate(hcrc16Multi_T *hctx, errBuffer_T *_fragments)
+{
+    const uint8_t *_next[ERR_MULTI_LANES];
+    size_t _left[ERR_MULTI_LANES];
+    uint8_t _active[ERR_MULTI_LANES];
+    const uint8_t *_lane[8];
+    uint16_t _CRC[8];
+    size_t _common = 0x00;
+    size_t _total = 0x00;
+    uint8_t _count = 0x00;
+    uint8_t _group = 0x00;
+    uint8_t _index = 0x00;
+    uint8_t _slot = 0x00;
+    errKernel_T _kernel = ERR_KERNEL_TABLE;
+
+    for(_index = 0; _index < hctx->Lanes; _index++)
+    {
+        _next[_index] = _fragments[_index].Data;
+        _left[_index] = _fragments[_index].Length;
+        _total += _fragments[_index].Length;
+    };
+
+    ERR_STATS_BEGIN(ERR_ALGO_CRC16, _total);
+
+    while(true)
+    {
+        _count = 0x00;
+        _common = SIZE_MAX;
+        for(_index = 0; _index < hctx->Lanes; _index++)
+        {
+            if(_left[_index] > 0)
+            {
+                _active[_count++] = _index;
+                if(_left[_index] < _common)
+                {
+                    _common = _left[_index];
+                };
+            };
+        };
+
+        if(_count == 0)
+        {
+            break;
+        };
+
+#if ERR_HW_SIMD && defined(__x86_64__)
+        if((_count >= 5) && (_count <= 8) && (_common >= 16) && (err_CpuDetect() & ERR_CPU_SSSE3))
+        {
+            _common &= ~(size_t)15;
+            for(_slot = 0; _slot < 8; _slot++)
+            {
+                _index = _active[(_slot < _count) ? _slot : 0];
+                _lane[_slot] = _next[_index];
+                _CRC[_slot] = hctx->Reg[_index];
+            };
+
+            crc16_SimdUpdate8(hctx->htable->Table, hctx->htable->Config.refIn, _CRC, _lane, _common);
+            _kernel = ERR_KERNEL_SIMD;
+
+            for(_slot = 0; _slot < _count; _slot++)
+            {
+                hctx->Reg[_active[_slot]] = _CRC[_slot];
+            };
+        }
+        else
+#endif
+        {
+            for(_group = 0; _group < _count; _group += 4)
+            {
+                for(_slot = 0; _slot < 4; _slot++)
+                {
+                    _index = _active[(_group + _slot < _count) ? _group + _slot : _group];
+                    _lane[_slot] = _next[_index];
+                    _CRC[_slot] = hctx->Reg[_index];
+                };
+
+                crc16_TableUpdate4(hctx->htable->Table, hctx->htable->Config.refIn, _CRC, _lane, _common);
+
+                for(_slot = 0; (_slot < 4) && (_group + _slot < _count); _slot++)
+                {
+                    hctx->Reg[_active[_group + _slot]] = _CRC[_slot];
+                };
+            };
+        };
+
+        for(_index = 0; _index < _count; _index++)
+        {
+            _next[_active[_index]] += _common;
+            _left[_active[_index]] -= _common;
+        };
+    };
+
+    (void)_kernel;
+    ERR_STATS_DONE(ERR_ALGO_CRC16, _kernel);
+};
+
+
+/**
+ * @brief Returns the CRC16 of one lane of a multi-stream calculation
+ * @param hctx Pointer to CRC16 multi-stream context
+ * @param _lane Lane index
+ * @return uint16_t Final CRC value of all fragments fed to the lane so far
+ * 
+ * @note The context is not modified, so the lane may still be extended.
+ */
+uint16_t CRC16_MultiFinal(hcrc16Multi_T *hctx, uint8_t _lane)
+{
+    return crc16_Final(hctx->hcrc[_lane], hctx->Reg[_lane]);
+};
+
+
+#if ERR_PRESETS
+
+#if ERR_PRESET_NIBBLE
+
+/**
+ * @brief CRC-8/MAXIM nibble table (Poly 0x31, reflected)
+ */
+static const uint8_t CRC8_MAXIM_Nibble[16] ERR_ROM =
+{
+    0x00, 0x9D, 0x23, 0xBE, 0x46, 0xDB, 0x65, 0xF8,
+    0x8C, 0x11, 0xAF, 0x32, 0xCA, 0x57, 0xE9, 0x74
+};
+
+/**
+ * @brief CRC-8/NRSC-5 nibble table (Poly 0x31, MSB-first)
+ */
+static const uint8_t CRC8_NRSC5_Nibble[16] ERR_ROM =
+{
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97,
+    0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E
+};
+
+/**
+ * @brief CRC-8/ATM nibble table (Poly 0x07, MSB-first)
+ */
+static const uint8_t CRC8_ATM_Nibble[16] ERR_ROM =
+{
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+    0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+
+/**
+ * @brief CRC-8/SAE-J1850 nibble table (Poly 0x1D, MSB-first)
+ */
+static const uint8_t CRC8_SAE_J1850_Nibble[16] ERR_ROM =
+{
+    0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53,
+    0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB
+};
+
+/**
+ * @brief CRC-16/MODBUS nibble table (Poly 0x8005, reflected)
+ */
+static const uint16_t CRC16_MODBUS_Nibble[16] ERR_ROM =
+{
+    0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+    0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+};
+
+/**
+ * @brief CRC-16/CCITT-FALSE nibble table (Poly 0x1021, MSB-first)
+ */
+static const uint16_t CRC16_CCITT_FALSE_Nibble[16] ERR_ROM =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/**
+ * @brief CRC-32/ISO-HDLC (Ethernet) nibble table (Poly 0x04C11DB7, reflected)
+ */
+static const uint32_t CRC32_ISO_HDLC_Nibble[16] ERR_ROM =
+{
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+/**
+ * @brief CRC-32C (Castagnoli) nibble table (Poly 0x1EDC6F41, reflected)
+ */
+static const uint32_t CRC32C_Nibble[16] ERR_ROM =
+{
+    0x00000000, 0x105EC76F, 0x20BD8EDE, 0x30E349B1,
+    0x417B1DBC, 0x5125DAD3, 0x61C69362, 0x7198540D,
+    0x82F63B78, 0x92A8FC17, 0xA24BB5A6, 0xB21572C9,
+    0xC38D26C4, 0xD3D3E1AB, 0xE330A81A, 0xF36E6F75
+};
+
+#else
+
+/**
+ * @brief CRC-8/MAXIM lookup table (Poly 0x31, reflected)
+ */
+static const uint8_t CRC8_MAXIM_Table[256] ERR_ROM =
+{
+    0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41,
+    0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC,
+    0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62,
+    0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF,
+    0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07,
+    0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A,
+    0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24,
+    0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9,
+    0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD,
+    0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50,
+    0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE,
+    0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73,
+    0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B,
+    0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16,
+    0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8,
+    0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35
+};
+
+/**
+ * @brief CRC-8/NRSC-5 lookup table (Poly 0x31, MSB-first)
+ */
+static const uint8_t CRC8_NRSC5_Table[256] ERR_ROM =
+{
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E,
+    0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D,
+    0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8,
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB,
+    0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13,
+    0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95,
+    0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6,
+    0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17,
+    0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2,
+    0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69,
+    0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A,
+    0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC
+};
+
+/**
+ * @brief CRC-8/ATM lookup table (Poly 0x07, MSB-first)
+ */
+static const uint8_t CRC8_ATM_Table[256] ERR_ROM =
+{
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+
+/**
+ * @brief CRC-8/SAE-J1850 lookup table (Poly 0x1D, MSB-first)
+ */
+static const uint8_t CRC8_SAE_J1850_Table[256] ERR_ROM =
+{
+    0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB,
+    0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76,
+    0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C,
+    0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1,
+    0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8,
+    0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65,
+    0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F,
+    0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2,
+    0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D,
+    0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50,
+    0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A,
+    0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7,
+    0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E,
+    0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43,
+    0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09,
+    0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4
+};
+
+/**
+ * @brief CRC-16/MODBUS lookup table (Poly 0x8005, reflected)
+ */
+static const uint16_t CRC16_MODBUS_Table[256] ERR_ROM =
+{
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+
+/**
+ * @brief CRC-16/CCITT-FALSE lookup table (Poly 0x1021, MSB-first)
+ */
+static const uint16_t CRC16_CCITT_FALSE_Table[256] ERR_ROM =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+
+/**
+ * @brief CRC-32/ISO-HDLC (Ethernet) lookup table (Poly 0x04C11DB7, reflected)
+ */
+static const uint32_t CRC32_ISO_HDLC_Table[256] ERR_ROM =
+{
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F,
+    0xE963A535, 0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
+    0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91, 0x1DB71064, 0x6AB020F2,
+    0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9,
+    0xFA0F3D63, 0x8D080DF5, 0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
+    0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B, 0x35B5A8FA, 0x42B2986C,
+    0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423,
+    0xCFBA9599, 0xB8BDA50F, 0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
+    0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D, 0x76DC4190, 0x01DB7106,
+    0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D,
+    0x91646C97, 0xE6635C01, 0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
+    0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457, 0x65B0D9C6, 0x12B7E950,
+    0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7,
+    0xA4D1C46D, 0xD3D6F4FB, 0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
+    0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9, 0x5005713C, 0x270241AA,
+    0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81,
+    0xB7BD5C3B, 0xC0BA6CAD, 0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
+    0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683, 0xE3630B12, 0x94643B84,
+    0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB,
+    0x196C3671, 0x6E6B06E7, 0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
+    0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5, 0xD6D6A3E8, 0xA1D1937E,
+    0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55,
+    0x316E8EEF, 0x4669BE79, 0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
+    0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F, 0xC5BA3BBE, 0xB2BD0B28,
+    0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F,
+    0x72076785, 0x05005713, 0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
+    0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21, 0x86D3D2D4, 0xF1D4E242,
+    0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69,
+    0x616BFFD3, 0x166CCF45, 0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
+    0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB, 0xAED16A4A, 0xD9D65ADC,
+    0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693,
+    0x54DE5729, 0x23D967BF, 0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
+    0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+
+/**
+ * @brief CRC-32C (Castagnoli) lookup table (Poly 0x1EDC6F41, reflected)
+ */
+static const uint32_t CRC32C_Table[256] ERR_ROM =
+{
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C,
+    0x26A1E7E8, 0xD4CA64EB, 0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B,
+    0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24, 0x105EC76F, 0xE235446C,
+    0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC,
+    0xBC267848, 0x4E4DFB4B, 0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A,
+    0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35, 0xAA64D611, 0x580F5512,
+    0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD,
+    0x1642AE59, 0xE4292D5A, 0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A,
+    0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595, 0x417B1DBC, 0xB3109EBF,
+    0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F,
+    0xED03A29B, 0x1F682198, 0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927,
+    0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38, 0xDBFC821C, 0x2997011F,
+    0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E,
+    0x4767748A, 0xB50CF789, 0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859,
+    0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46, 0x7198540D, 0x83F3D70E,
+    0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE,
+    0xDDE0EB2A, 0x2F8B6829, 0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C,
+    0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93, 0x082F63B7, 0xFA44E0B4,
+    0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B,
+    0xB4091BFF, 0x466298FC, 0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C,
+    0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033, 0xA24BB5A6, 0x502036A5,
+    0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975,
+    0x0E330A81, 0xFC588982, 0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D,
+    0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622, 0x38CC2A06, 0xCAA7A905,
+    0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8,
+    0xE52CC12C, 0x1747422F, 0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF,
+    0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0, 0xD3D3E1AB, 0x21B862A8,
+    0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78,
+    0x7FAB5E8C, 0x8DC0DD8F, 0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE,
+    0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1, 0x69E9F0D5, 0x9B8273D6,
+    0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69,
+    0xD5CF889D, 0x27A40B9E, 0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E,
+    0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+};
+
+#endif /* ERR_PRESET_NIBBLE */
+
+/**
+ * @brief Hardware hook for reflected CRC32 presets
+ * @details Runs the whole buffer through crc32_HwCalc when the polynomial
+ *          and the CPU are supported, leaving nothing for the table loop.
+ */
+#if ERR_HW_CRC
+  #define ERR_PRESET_HW(_poly)   if(crc32_HwCalc(_poly, &_CRC, _data, _dataLength)) { _dataLength = 0x00; };
+#else
+  #define ERR_PRESET_HW(_poly)
+#endif
+
+/**
+ * @brief Empty hook for presets computed in software only
+ */
+#define ERR_PRESET_SW
+
+/**
+ * @brief Defines the Calc function of a CRC8 preset
+ * @details An 8-bit register is consumed whole by every byte, so the same
+ *          loop serves reflected and MSB-first presets (the table differs).
+ * @param _name Preset name; defines _name##_Calc reading _name##_Table
+ * @param _init Initial register value
+ * @param _xorOut Final XOR value
+ */
+#define ERR_PRESET_CRC8(_name, _init, _xorOut)                                       \
+uint8_t _name##_Calc(uint8_t *_data, size_t _dataLength)                             \
+{                                                                                    \
+    uint8_t _CRC = _init;                                                            \
+                                                                                     \
+    for(; _dataLength > 0; _dataLength--, _data++)                                   \
+    {                                                                                \
+        _CRC = ERR_ROM_READ8(&_name##_Table[_CRC ^ *_data]);                         \
+    };                                                                               \
+                                                                                     \
+    return (uint8_t)(_CRC ^ (_xorOut));                                              \
+}
+
+/**
+ * @brief Defines the Calc function of a reflected (refIn = refOut = true) CRC16/CRC32 preset
+ * @param _name Preset name; defines _name##_Calc reading _name##_Table
+ * @param _type Register type (uint16_t or uint32_t)
+ * @param _read ROM read macro matching _type
+ * @param _init Initial register value (reflected Init)
+ * @param _xorOut Final XOR value (reflected xorOut)
+ * @param _hook ERR_PRESET_HW(Poly) or ERR_PRESET_SW, run before the table loop
+ */
+#define ERR_PRESET_REFLECTED(_name, _type, _read, _init, _xorOut, _hook)            \
+_type _name##_Calc(uint8_t *_data, size_t _dataLength)                               \
+{                                                                                    \
+    _type _CRC = _init;                                                              \
+                                                                                     \
+    _hook                                                                            \
+    for(; _dataLength > 0; _dataLength--, _data++)                                   \
+    {                                                                                \
+        _CRC = (_type)((_CRC >> 8) ^ _read(&_name##_Table[(uint8_t)(_CRC ^ *_data)])); \
+    };                                                                               \
+                                                                                     \
+    return (_type)(_CRC ^ (_xorOut));                                                \
+}
+
+/**
+ * @brief Defines the Calc function of an MSB-first (refIn = refOut = false) CRC16/CRC32 preset
+ * @param _name Preset name; defines _name##_Calc reading _name##_Table
+ * @param _type Register type (uint16_t or uint32_t)
+ * @param _read ROM read macro matching _type
+ * @param _width Register width in bits (16 or 32)
+ * @param _init Initial register value
+ * @param _xorOut Final XOR value
+ */
+#define ERR_PRESET_NORMAL(_name, _type, _read, _width, _init, _xorOut)                \
+_type _name##_Calc(uint8_t *_data, size_t _dataLength)                               \
+{                                                                                    \
+    _type _CRC = _init;                                                              \
+                                                                                     \
+    for(; _dataLength > 0; _dataLength--, _data++)                                   \
+    {                                                                                \
+        _CRC = (_type)((_CRC << 8) ^ _read(&_name##_Table[(uint8_t)((_CRC >> ((_width) - 8)) ^ *_data)])); \
+    };                                                                               \
+                                                                                     \
+    return (_type)(_CRC ^ (_xorOut));                                                \
+}
+
+/**
+ * @brief Defines the Calc function of a reflected preset with a nibble table
+ * @param _name Preset name; defines _name##_Calc reading _name##_Nibble
+ * @param _type Register type (uint8_t, uint16_t or uint32_t)
+ * @param _read ROM read macro matching _type
+ * @param _init Initial register value (reflected Init)
+ * @param _xorOut Final XOR value (reflected xorOut)
+ * @param _hook ERR_PRESET_HW(Poly) or ERR_PRESET_SW, run before the table loop
+ */
+#define ERR_PRESET_NIBBLE_REFLECTED(_name, _type, _read, _init, _xorOut, _hook)     \
+_type _name##_Calc(uint8_t *_data, size_t _dataLength)                               \
+{                                                                                    \
+    _type _CRC = _init;                                                              \
+                                                                                     \
+    _hook                                                                            \
+    for(; _dataLength > 0; _dataLength--, _data++)                                   \
+    {                                                                                \
+        _CRC ^= *_data;                                                              \
+        _CRC = (_type)((_CRC >> 4) ^ _read(&_name##_Nibble[_CRC & 0x0F]));           \
+        _CRC = (_type)((_CRC >> 4) ^ _read(&_name##_Nibble[_CRC & 0x0F]));           \
+    };                                                                               \
+                                                                                     \
+    return (_type)(_CRC ^ (_xorOut));                                                \
+}
+
+/**
+ * @brief Defines the Calc function of an MSB-first preset with a nibble table
+ * @param _name Preset name; defines _name##_Calc reading _name##_Nibble
+ * @param _type Register type (uint8_t, uint16_t or uint32_t)
+ * @param _read ROM read macro matching _type
+ * @param _width Register width in bits (8, 16 or 32)
+ * @param _init Initial register value
+ * @param _xorOut Final XOR value
+ */
+#define ERR_PRESET_NIBBLE_NORMAL(_name, _type, _read, _width, _init, _xorOut)       \
+_type _name##_Calc(uint8_t *_data, size_t _dataLength)                               \
+{                                                                                    \
+    _type _CRC = _init;                                                              \
+                                                                                     \
+    for(; _dataLength > 0; _dataLength--, _data++)                                   \
+    {                                                                                \
+        _CRC ^= (_type)(((_type)*_data) << ((_width) - 8));                          \
+        _CRC = (_type)((_CRC << 4) ^ _read(&_name##_Nibble[_CRC >> ((_width) - 4)])); \
+        _CRC = (_type)((_CRC << 4) ^ _read(&_name##_Nibble[_CRC >> ((_width) - 4)])); \
+    };                                                                               \
+                                                                                     \
+    return (_type)(_CRC ^ (_xorOut));                                                \
+}
+
+#if ERR_PRESET_NIBBLE
+ERR_PRESET_NIBBLE_REFLECTED(CRC8_MAXIM, uint8_t, ERR_ROM_READ8, 0x00, 0x00, ERR_PRESET_SW)
+ERR_PRESET_NIBBLE_NORMAL(CRC8_NRSC5, uint8_t, ERR_ROM_READ8, 8, 0xFF, 0x00)
+ERR_PRESET_NIBBLE_NORMAL(CRC8_ATM, uint8_t, ERR_ROM_READ8, 8, 0x00, 0x00)
+ERR_PRESET_NIBBLE_NORMAL(CRC8_SAE_J1850, uint8_t, ERR_ROM_READ8, 8, 0xFF, 0xFF)
+ERR_PRESET_NIBBLE_REFLECTED(CRC16_MODBUS, uint16_t, ERR_ROM_READ16, 0xFFFF, 0x0000, ERR_PRESET_SW)
+ERR_PRESET_NIBBLE_NORMAL(CRC16_CCITT_FALSE, uint16_t, ERR_ROM_READ16, 16, 0xFFFF, 0x0000)
+ERR_PRESET_NIBBLE_REFLECTED(CRC32_ISO_HDLC, uint32_t, ERR_ROM_READ32, 0xFFFFFFFF, 0xFFFFFFFF, ERR_PRESET_HW(0x04C11DB7))
+ERR_PRESET_NIBBLE_REFLECTED(CRC32C, uint32_t, ERR_ROM_READ32, 0xFFFFFFFF, 0xFFFFFFFF, ERR_PRESET_HW(0x1EDC6F41))
+#else
+ERR_PRESET_CRC8(CRC8_MAXIM, 0x00, 0x00)
+ERR_PRESET_CRC8(CRC8_NRSC5, 0xFF, 0x00)
+ERR_PRESET_CRC8(CRC8_ATM, 0x00, 0x00)
+ERR_PRESET_CRC8(CRC8_SAE_J1850, 0xFF, 0xFF)
+ERR_PRESET_REFLECTED(CRC16_MODBUS, uint16_t, ERR_ROM_READ16, 0xFFFF, 0x0000, ERR_PRESET_SW)
+ERR_PRESET_NORMAL(CRC16_CCITT_FALSE, uint16_t, ERR_ROM_READ16, 16, 0xFFFF, 0x0000)
+ERR_PRESET_REFLECTED(CRC32_ISO_HDLC, uint32_t, ERR_ROM_READ32, 0xFFFFFFFF, 0xFFFFFFFF, ERR_PRESET_HW(0x04C11DB7))
+ERR_PRESET_REFLECTED(CRC32C, uint32_t, ERR_ROM_READ32, 0xFFFFFFFF, 0xFFFFFFFF, ERR_PRESET_HW(0x1EDC6F41))
+
+#endif /* ERR_PRESET_NIBBLE */
+
+#endif /* ERR_PRESETS */
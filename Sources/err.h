@@ -17,6 +17,210 @@
 #define _err_H_
 
 #include "aKaReZa.h"
+#include <stddef.h>
+
+/**
+ * @brief Hardware CRC32 backend switch
+ * @details When set to 1, CRC32 configurations with refIn set and a polynomial
+ *          implemented by the CPU are computed with CRC instructions:
+ *          - x86-64 SSE4.2 `crc32`     : CRC-32C (Poly 0x1EDC6F41)
+ *          - ARMv8 CRC32 extension    : CRC-32C (Poly 0x1EDC6F41) and CRC-32 (Poly 0x04C11DB7)
+ *          CPU support is detected once at runtime; other configurations and
+ *          CPUs without the instructions use the software engines.
+ *          Defaults to 1 for x86-64 / AArch64 builds with GCC or Clang, 0 otherwise.
+ */
+#ifndef ERR_HW_CRC
+  #if (defined(__x86_64__) || defined(__aarch64__)) && defined(__GNUC__)
+    #define ERR_HW_CRC 1
+  #else
+    #define ERR_HW_CRC 0
+  #endif
+#endif
+
+/**
+ * @brief Carry-less multiply folding backend switch
+ * @details When set to 1, CRC16_TableCalc and CRC32_TableCalc fold long buffers
+ *          64 bytes per iteration with carry-less multiplication (x86 PCLMULQDQ,
+ *          ARMv8 PMULL), using fold constants derived from the configured Poly
+ *          by CRCxx_TableInit; so any 16/32-bit polynomial is accelerated.
+ *          CPU support is detected once at runtime.
+ *          Defaults to the value of ERR_HW_CRC.
+ */
+#ifndef ERR_HW_CLMUL
+  #define ERR_HW_CLMUL ERR_HW_CRC
+#endif
+
+/**
+ * @brief SIMD checksum backend switch
+ * @details When set to 1, checkSum8/16/32 sum long buffers with SIMD
+ *          horizontal byte sums (x86-64 SSE2 PSADBW, AVX2 VPSADBW picked at
+ *          runtime, AArch64 NEON). Results keep the modular wraparound of
+ *          each checksum width. Defaults to the value of ERR_HW_CRC.
+ */
+#ifndef ERR_HW_SIMD
+  #define ERR_HW_SIMD ERR_HW_CRC
+#endif
+
+/**
+ * @brief Word-at-a-time (SWAR) checksum switch for 32-bit MCUs without SIMD
+ * @details When set to 1, checkSum8/16/32 load aligned 32-bit words and add
+ *          their four bytes in parallel (USADA8 on cores with the DSP
+ *          extension such as Cortex-M4/M7, two 16-bit lanes otherwise);
+ *          unaligned head and tail bytes use the byte loop.
+ *          Defaults to 1 for 32-bit ARM targets without NEON (Cortex-M), 0 otherwise.
+ */
+#ifndef ERR_SUM_SWAR
+  #if defined(__arm__) && !defined(__ARM_NEON) && !ERR_HW_SIMD
+    #define ERR_SUM_SWAR 1
+  #else
+    #define ERR_SUM_SWAR 0
+  #endif
+#endif
+
+/**
+ * @brief Minimum buffer length (bytes) before the folding kernel is used
+ * @details Must be at least 64; shorter buffers are faster on the byte table.
+ */
+#ifndef ERR_CLMUL_MIN_LENGTH
+  #define ERR_CLMUL_MIN_LENGTH 128
+#endif
+
+/**
+ * @brief Preset CRC functions switch
+ * @details When set to 1, the specialised preset functions (CRC16_MODBUS_Calc,
+ *          CRC32C_Calc, ...) and their ROM tables are compiled in.
+ *          Unused presets are dropped by the linker when the build uses
+ *          -ffunction-sections -fdata-sections -Wl,--gc-sections.
+ *          Defaults to 1.
+ */
+#ifndef ERR_PRESETS
+  #define ERR_PRESETS 1
+#endif
+
+/**
+ * @brief Nibble tables for the preset functions
+ * @details When set to 1, the <PRESET>_Calc functions read 16-entry ROM
+ *          tables (two lookups per byte) instead of 256-entry ones:
+ *          16/32/64 bytes of flash per CRC8/CRC16/CRC32 preset instead of
+ *          256 bytes/512 bytes/1 KB. Meant for small AVR parts. Defaults to 0.
+ */
+#ifndef ERR_PRESET_NIBBLE
+  #define ERR_PRESET_NIBBLE 0
+#endif
+
+/**
+ * @brief Table cache size (tables per width, static RAM)
+ * @details CRCxx_TableGet/CRCxx_CachedCalc build the table of a (Poly, refIn)
+ *          pair on first use and keep it in a static pool of this many slots;
+ *          the pool never evicts, so a full pool falls back to the bitwise
+ *          engine. Each slot costs one table context (about 260 bytes/
+ *          520 bytes/1 KB for CRC8/CRC16/CRC32). ERR_TABLE_CACHE_8/_16/_32
+ *          override a single width. Defaults to 8 on hosts, 0 (disabled) on MCUs.
+ *          Table builds are guarded by ERR_CACHE_LOCK()/ERR_CACHE_UNLOCK(),
+ *          which may be defined before including err.h (see err.c).
+ */
+#ifndef ERR_TABLE_CACHE
+  #if (defined(__x86_64__) || defined(__aarch64__)) && defined(__GNUC__)
+    #define ERR_TABLE_CACHE 8
+  #else
+    #define ERR_TABLE_CACHE 0
+  #endif
+#endif
+
+#ifndef ERR_TABLE_CACHE_8
+  #define ERR_TABLE_CACHE_8 ERR_TABLE_CACHE
+#endif
+
+#ifndef ERR_TABLE_CACHE_16
+  #define ERR_TABLE_CACHE_16 ERR_TABLE_CACHE
+#endif
+
+#ifndef ERR_TABLE_CACHE_32
+  #define ERR_TABLE_CACHE_32 ERR_TABLE_CACHE
+#endif
+
+/**
+ * @brief Minimum buffer length (bytes) before the automatic kernel uses a table
+ * @details With ERR_KERNEL_AUTO, CRCxx_Calc runs buffers of at least this
+ *          length on the cached table of the configuration (and its folding
+ *          or CRC instruction fast paths); shorter buffers, and every buffer
+ *          when the table cache is disabled, use the bitwise engine.
+ */
+#ifndef ERR_DISPATCH_MIN_LENGTH
+  #define ERR_DISPATCH_MIN_LENGTH 16
+#endif
+
+/**
+ * @brief Maximum number of lanes of a multi-stream CRC context (hcrc16Multi_T)
+ * @details One lane per independent stream (serial port, channel, ...);
+ *          each lane costs one register and one configuration pointer.
+ */
+#ifndef ERR_MULTI_LANES
+  #define ERR_MULTI_LANES 8
+#endif
+
+/**
+ * @brief Instrumentation switch
+ * @details When set to 1, the one-shot, table, nibble, slicing, streaming
+ *          and verify entry points count calls, bytes and cycles per
+ *          algorithm and per kernel, and the verify functions count CRC
+ *          mismatches; err_StatsGet reads them and the ERR_TRACE_BEGIN /
+ *          ERR_TRACE_END hooks are called around every counted call.
+ *          Counters are updated atomically on x86-64 / AArch64 GCC or Clang
+ *          builds and with plain additions elsewhere (not interrupt-safe).
+ *          Defaults to 0: the layer compiles to nothing.
+ */
+#ifndef ERR_STATS
+  #define ERR_STATS 0
+#endif
+
+/**
+ * @brief Instrumentation cycle counter hook (ERR_STATS_CYCLES())
+ * @details Read before and after every counted call. Defaults to the TSC on
+ *          x86-64 and the virtual counter (CNTVCT_EL0) on AArch64 GCC/Clang
+ *          builds, and to 0 (no cycle counts) elsewhere; on Cortex-M define
+ *          e.g. #define ERR_STATS_CYCLES() DWT->CYCCNT before including err.h.
+ *          ERR_STATS_CYCLES_T is its type (uint64_t on hosts, uint32_t
+ *          otherwise); deltas wrap modulo its width.
+ */
+
+/**
+ * @brief Instrumentation trace hooks (ERR_TRACE_BEGIN(_algo, _length) /
+ *        ERR_TRACE_END(_algo, _kernel, _result))
+ * @details Called with ERR_STATS at the start and end of every counted call:
+ *          the errAlgo_T, the byte count, the errKernel_T that ran and the
+ *          result (CRC, checksum, or 1/0 for a verify). Default to nothing;
+ *          define them before including err.h, e.g. for SEGGER SystemView
+ *          #define ERR_TRACE_BEGIN(_algo, _length) SEGGER_SYSVIEW_RecordU32x2(ERR_SYSVIEW_ID, _algo, _length)
+ *          or for perf / bpftrace USDT probes (sys/sdt.h)
+ *          #define ERR_TRACE_END(_algo, _kernel, _result) DTRACE_PROBE3(err, end, _algo, _kernel, _result)
+ */
+
+/**
+ * @brief Read-only (flash) storage for constant tables
+ * @details On AVR constant data is copied to RAM unless it is placed in
+ *          program memory, so ERR_ROM maps to PROGMEM and the ERR_ROM_READxx
+ *          macros to the pgm_read_xxx accessors. Other targets keep const
+ *          data in flash already and read it directly.
+ */
+#ifndef ERR_ROM
+  #if defined(__AVR__)
+    #include <avr/pgmspace.h>
+    #define ERR_ROM              PROGMEM
+    #define ERR_ROM_READ8(_p)    pgm_read_byte(_p)
+    #define ERR_ROM_READ16(_p)   pgm_read_word(_p)
+    #define ERR_ROM_READ32(_p)   pgm_read_dword(_p)
+  #else
+    #define ERR_ROM
+    #define ERR_ROM_READ8(_p)    (*(_p))
+    #define ERR_ROM_READ16(_p)   (*(_p))
+    #define ERR_ROM_READ32(_p)   (*(_p))
+  #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /**
  * @brief CRC8 configuration structure
@@ -57,6 +261,463 @@ typedef struct
   uint32_t xorOut;  ///< Final XOR value for CRC32 result
 } hcrc32_T;
 
+/**
+ * @brief Standard CRC presets (see CRC_Reference.md)
+ * @details Compile-time initializers for the configuration structures, in
+ *          field order {Poly, Init, refIn, refOut, xorOut}:
+ * @code
+ *          hcrc16_T hcrc = CRC16_MODBUS;
+ *          uint16_t _CRC = CRC16_Calc(&hcrc, _frame, _frameLength);
+ * @endcode
+ *          Declare the structure const/static to keep it in flash; the
+ *          matching CRCxx_<PRESET>_Calc functions need no structure at all.
+ */
+#define CRC8_MAXIM          { 0x31,       0x00,       true,  true,  0x00       }  ///< Maxim/Dallas 1-Wire (DS18B20)
+#define CRC8_NRSC5          { 0x31,       0xFF,       false, false, 0x00       }  ///< AHT20 temperature/humidity
+#define CRC8_ATM            { 0x07,       0x00,       false, false, 0x00       }  ///< ATM networks, lightweight protocols
+#define CRC8_SAE_J1850      { 0x1D,       0xFF,       false, false, 0xFF       }  ///< Automotive (SAE J1850 frames)
+#define CRC16_MODBUS        { 0x8005,     0xFFFF,     true,  true,  0x0000     }  ///< MODBUS RTU
+#define CRC16_CCITT_FALSE   { 0x1021,     0xFFFF,     false, false, 0x0000     }  ///< X.25, HDLC, Bluetooth
+#define CRC32_ISO_HDLC      { 0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF }  ///< Ethernet, ZIP, PNG
+#define CRC32C              { 0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF }  ///< iSCSI, SATA, Btrfs
+
+/**
+ * @brief CRC8 lookup table context
+ * @details Holds a copy of the CRC8 configuration together with its
+ *          precomputed 256-entry table (256 bytes of RAM)
+ */
+typedef struct 
+{
+  hcrc8_T Config;        ///< CRC8 configuration the table was built from
+  uint8_t Table[256];    ///< CRC8 remainder for every possible input byte
+} hcrc8Table_T;
+
+/**
+ * @brief CRC16 lookup table context
+ * @details Holds a copy of the CRC16 configuration together with its
+ *          precomputed 256-entry table (512 bytes of RAM) and, when
+ *          ERR_HW_CLMUL is enabled, the folding constants for its Poly
+ */
+typedef struct 
+{
+  hcrc16_T Config;       ///< CRC16 configuration the table was built from
+  uint16_t Table[256];   ///< CRC16 remainder for every possible input byte
+#if ERR_HW_CLMUL
+  uint64_t Fold[4];      ///< Carry-less multiply fold constants (64-byte and 16-byte distance)
+#endif
+} hcrc16Table_T;
+
+/**
+ * @brief CRC32 lookup table context
+ * @details Holds a copy of the CRC32 configuration together with its
+ *          precomputed 256-entry table (1 KB of RAM) and, when
+ *          ERR_HW_CLMUL is enabled, the folding constants for its Poly
+ */
+typedef struct 
+{
+  hcrc32_T Config;       ///< CRC32 configuration the table was built from
+  uint32_t Table[256];   ///< CRC32 remainder for every possible input byte
+#if ERR_HW_CLMUL
+  uint64_t Fold[4];      ///< Carry-less multiply fold constants (64-byte and 16-byte distance)
+#endif
+} hcrc32Table_T;
+
+/**
+ * @brief CRC8 nibble table context
+ * @details Holds a copy of the CRC8 configuration together with its
+ *          16-entry table (16 bytes of RAM): two lookups per byte, the
+ *          middle ground between the bitwise loop and the 256-entry table
+ */
+typedef struct 
+{
+  hcrc8_T Config;        ///< CRC8 configuration the table was built from
+  uint8_t Table[16];     ///< CRC8 remainder for every possible input nibble
+} hcrc8Nibble_T;
+
+/**
+ * @brief CRC16 nibble table context
+ * @details Holds a copy of the CRC16 configuration together with its
+ *          16-entry table (32 bytes of RAM)
+ */
+typedef struct 
+{
+  hcrc16_T Config;       ///< CRC16 configuration the table was built from
+  uint16_t Table[16];    ///< CRC16 remainder for every possible input nibble
+} hcrc16Nibble_T;
+
+/**
+ * @brief CRC32 nibble table context
+ * @details Holds a copy of the CRC32 configuration together with its
+ *          16-entry table (64 bytes of RAM)
+ */
+typedef struct 
+{
+  hcrc32_T Config;       ///< CRC32 configuration the table was built from
+  uint32_t Table[16];    ///< CRC32 remainder for every possible input nibble
+} hcrc32Nibble_T;
+
+/**
+ * @brief Number of lookup tables used by the CRC32 slicing-by-N engine
+ * @details Selects how many bytes CRC32_SliceCalc consumes per iteration.
+ *          Allowed values and the memory taken by hcrc32Slice_T tables:
+ *          - 4  : 4 tables,  4 KB
+ *          - 8  : 8 tables,  8 KB (default)
+ *          - 16 : 16 tables, 16 KB
+ *          Define it before including err.h (or in the compiler flags).
+ */
+#ifndef CRC32_SLICE_N
+#define CRC32_SLICE_N 8
+#endif
+
+#if (CRC32_SLICE_N != 4) && (CRC32_SLICE_N != 8) && (CRC32_SLICE_N != 16)
+#error "CRC32_SLICE_N must be 4, 8 or 16"
+#endif
+
+/**
+ * @brief CRC32 slicing-by-N context
+ * @details Holds a copy of the CRC32 configuration together with
+ *          CRC32_SLICE_N precomputed 256-entry tables (CRC32_SLICE_N KB of RAM)
+ */
+typedef struct 
+{
+  hcrc32_T Config;                      ///< CRC32 configuration the tables were built from
+  uint32_t Table[CRC32_SLICE_N][256];   ///< Table[0] is the byte table, Table[k] advances it k more bytes
+} hcrc32Slice_T;
+
+/**
+ * @brief CRC8 streaming context
+ * @details Keeps the running CRC8 register between CRC8_Update calls
+ */
+typedef struct 
+{
+  hcrc8_T *hcrc;           ///< Configuration in use
+  hcrc8Table_T *htable;    ///< Table context, or NULL for the bitwise engine
+  uint8_t Reg;             ///< Running CRC register (reflected order when refIn is set)
+} hcrc8Ctx_T;
+
+/**
+ * @brief CRC16 streaming context
+ * @details Keeps the running CRC16 register between CRC16_Update calls
+ */
+typedef struct 
+{
+  hcrc16_T *hcrc;          ///< Configuration in use
+  hcrc16Table_T *htable;   ///< Table context, or NULL for the bitwise engine
+  uint16_t Reg;            ///< Running CRC register (reflected order when refIn is set)
+} hcrc16Ctx_T;
+
+/**
+ * @brief CRC32 streaming context
+ * @details Keeps the running CRC32 register between CRC32_Update calls
+ */
+typedef struct 
+{
+  hcrc32_T *hcrc;          ///< Configuration in use
+  hcrc32Table_T *htable;   ///< Table context, or NULL
+  hcrc32Slice_T *hslice;   ///< Slicing context, or NULL (bitwise engine when both are NULL)
+  uint32_t Reg;            ///< Running CRC register (reflected order when refIn is set)
+} hcrc32Ctx_T;
+
+/**
+ * @brief Generic CRC configuration structure
+ * @details CRC of any width from 3 to 64 bits. Parameters follow the same
+ *          model as hcrc8_T/hcrc16_T/hcrc32_T and the CRC catalogue: Poly
+ *          without the implicit x^Width term, Init and xorOut in MSB-first
+ *          order; bits above Width are ignored.
+ */
+typedef struct 
+{
+  uint8_t Width;     ///< CRC width in bits (3..64)
+  uint64_t Poly;     ///< Polynomial value
+  uint64_t Init;     ///< Initial value
+  bool refIn;        ///< Input data reflection (true/false)
+  bool refOut;       ///< Output data reflection (true/false)
+  uint64_t xorOut;   ///< Final XOR value
+} hcrcN_T;
+
+/**
+ * @brief Standard presets of the generic CRC engine (see CRC_Reference.md)
+ * @details Initializers in field order {Width, Poly, Init, refIn, refOut, xorOut}:
+ * @code
+ *          hcrcN_T hcrc = CRC64_XZ;
+ *          uint64_t _CRC = CRCN_Calc(&hcrc, _block, _blockLength);
+ * @endcode
+ */
+#define CRC5_USB            { 5,  0x05ULL,               0x1FULL,               true,  true,  0x1FULL               }  ///< USB token packets
+#define CRC15_CAN           { 15, 0x4599ULL,             0x0000ULL,             false, false, 0x0000ULL             }  ///< Classical CAN frames
+#define CRC24_OPENPGP       { 24, 0x864CFBULL,           0xB704CEULL,           false, false, 0x000000ULL           }  ///< OpenPGP ASCII armor (RFC 4880)
+#define CRC64_ECMA_182      { 64, 0x42F0E1EBA9EA3693ULL, 0x0000000000000000ULL, false, false, 0x0000000000000000ULL }  ///< ECMA-182 (DLT tapes)
+#define CRC64_XZ            { 64, 0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, true,  true,  0xFFFFFFFFFFFFFFFFULL }  ///< xz, storage checksums
+
+/**
+ * @brief Generic CRC lookup table context
+ * @details Holds a copy of the configuration together with its precomputed
+ *          256-entry table (2 KB of RAM)
+ */
+typedef struct 
+{
+  hcrcN_T Config;        ///< Configuration the table was built from
+  uint64_t Table[256];   ///< Remainder for every possible input byte (top-aligned when refIn is false)
+} hcrcNTable_T;
+
+/**
+ * @brief Generic CRC nibble table context
+ * @details Holds a copy of the configuration together with its 16-entry
+ *          table (128 bytes of RAM)
+ */
+typedef struct 
+{
+  hcrcN_T Config;        ///< Configuration the table was built from
+  uint64_t Table[16];    ///< Remainder for every possible input nibble (top-aligned when refIn is false)
+} hcrcNNibble_T;
+
+/**
+ * @brief Generic CRC streaming context
+ * @details Keeps the running register between CRCN_Update calls
+ */
+typedef struct 
+{
+  hcrcN_T *hcrc;           ///< Configuration in use
+  hcrcNTable_T *htable;    ///< Table context, or NULL for the bitwise engine
+  uint64_t Reg;            ///< Running CRC register (reflected order when refIn is set)
+} hcrcNCtx_T;
+
+/**
+ * @brief Byte order of a CRC stored in a frame
+ */
+typedef enum
+{
+  ERR_ENDIAN_LITTLE = 0,   ///< Least significant byte first
+  ERR_ENDIAN_BIG    = 1    ///< Most significant byte first
+} errEndian_T;
+
+/**
+ * @brief Frame result callback of a receive pipeline
+ * @param _arg User argument passed to errPipe_Init
+ * @param _frame Index of the frame since errPipe_Init (0, 1, 2, ...)
+ * @param _valid true when the trailing CRC32 matches the payload
+ */
+typedef void (*errPipeCallback_T)(void *_arg, uint32_t _frame, bool _valid);
+
+/**
+ * @brief Receive-and-verify pipeline for DMA double-buffered streams
+ * @details Fixed-length frames (payload followed by a CRC32) arrive in
+ *          DMA half-buffers of any size; the streaming CRC is carried
+ *          from one half to the next and every completed frame is
+ *          reported through the callback.
+ */
+typedef struct 
+{
+  hcrc32Ctx_T Ctx;              ///< Streaming CRC of the frame being received
+  hcrc32Table_T *htable;        ///< Table context of the link configuration
+  size_t FrameLength;           ///< Payload plus 4-byte CRC, in bytes
+  size_t Position;              ///< Bytes of the current frame already received
+  errEndian_T Endian;           ///< Byte order of the CRC trailer
+  uint8_t Trailer[4];           ///< CRC trailer bytes of the current frame
+  uint32_t Frames;              ///< Frames completed since errPipe_Init
+  uint32_t Errors;              ///< Completed frames with a CRC mismatch
+  errPipeCallback_T Callback;   ///< Per-frame result callback, or NULL
+  void *Arg;                    ///< Argument of the callback
+} herrPipe_T;
+
+/**
+ * @brief Result of a CRC error-correction attempt
+ */
+typedef enum
+{
+  ERR_FIX_NONE      = 0,   ///< The frame was valid, nothing changed
+  ERR_FIX_CORRECTED = 1,   ///< One error (single bit or burst) was located and fixed
+  ERR_FIX_FAILED    = 2    ///< Not correctable (more errors, or an ambiguous syndrome)
+} errFix_T;
+
+/**
+ * @brief Syndrome lookup table entry of the error-correction mode
+ */
+typedef struct 
+{
+  uint32_t Syndrome;       ///< MSB-first register difference caused by the error
+  uint16_t Position;       ///< First flipped bit (shift order), or ERR_FIX_TRAILER / ERR_FIX_AMBIGUOUS
+  uint8_t Pattern;         ///< Flipped bits from Position on (bit 0 = Position), 0 = free slot
+} hcrcFixEntry_T;
+
+/**
+ * @brief CRC16 error-correction context for one frame length
+ */
+typedef struct 
+{
+  hcrc16Table_T *htable;     ///< Table context of the link configuration
+  size_t FrameLength;        ///< Payload plus 2-byte CRC, in bytes
+  hcrcFixEntry_T *Entries;   ///< Syndrome hash table (caller storage)
+  size_t Count;              ///< Number of entries in the hash table
+} hcrc16Fix_T;
+
+/**
+ * @brief CRC32 error-correction context for one frame length
+ */
+typedef struct 
+{
+  hcrc32Table_T *htable;     ///< Table context of the link configuration
+  size_t FrameLength;        ///< Payload plus 4-byte CRC, in bytes
+  hcrcFixEntry_T *Entries;   ///< Syndrome hash table (caller storage)
+  size_t Count;              ///< Number of entries in the hash table
+} hcrc32Fix_T;
+
+#define ERR_FIX_TRAILER    0xFFFE   ///< hcrcFixEntry_T.Position of an error in the CRC field
+#define ERR_FIX_AMBIGUOUS  0xFFFF   ///< hcrcFixEntry_T.Position of a syndrome shared by several errors
+
+/**
+ * @brief Hash table entries needed by CRCxx_FixInit
+ * @param _payloadLength Payload length in bytes (frame length without the CRC)
+ * @param _width CRC width in bits (16 or 32)
+ * @param _burst Longest correctable burst in bits (1 = single-bit errors only)
+ */
+#define ERR_FIX_ENTRIES(_payloadLength, _width, _burst)  (2 * (8 * (size_t)(_payloadLength) * ((size_t)1 << ((_burst) - 1)) + (_width)))
+
+/**
+ * @brief Function family behind one dispatch pointer
+ */
+typedef enum
+{
+  ERR_DISPATCH_CRC8  = 0,  ///< CRC8_Calc / CRC8_CalcLarge
+  ERR_DISPATCH_CRC16 = 1,  ///< CRC16_Calc / CRC16_CalcLarge
+  ERR_DISPATCH_CRC32 = 2,  ///< CRC32_Calc / CRC32_CalcLarge
+  ERR_DISPATCH_SUM   = 3,  ///< checkSum8/16/32_Calc / _CalcLarge
+  ERR_DISPATCH_COUNT = 4   ///< Number of function families
+} errDispatch_T;
+
+/**
+ * @brief Implementation (kernel) selected for a function family
+ */
+typedef enum
+{
+  ERR_KERNEL_AUTO    = 0,  ///< Default choice by configuration, buffer length and CPU
+  ERR_KERNEL_BITWISE = 1,  ///< CRC: original bit-at-a-time loop
+  ERR_KERNEL_NIBBLE  = 2,  ///< CRC: 16-entry table built per call, two lookups per byte
+  ERR_KERNEL_TABLE   = 3,  ///< CRC: cached 256-entry table, one lookup per byte
+  ERR_KERNEL_CLMUL   = 4,  ///< CRC16/32: cached table with carry-less multiply folding
+  ERR_KERNEL_HW      = 5,  ///< CRC32: CPU CRC32 instructions (CRC-32C, and CRC-32 on ARMv8)
+  ERR_KERNEL_SCALAR  = 6,  ///< Checksum: byte loop
+  ERR_KERNEL_SWAR    = 7,  ///< Checksum: four bytes per 32-bit word
+  ERR_KERNEL_SIMD    = 8,  ///< Checksum: SSE2 / NEON horizontal byte sums
+  ERR_KERNEL_AVX2    = 9,  ///< Checksum: AVX2 horizontal byte sums
+  ERR_KERNEL_SLICE   = 10, ///< CRC32: slicing-by-N tables (CRC32_SliceCalc, statistics only)
+  ERR_KERNEL_COUNT   = 11  ///< Number of kernels
+} errKernel_T;
+
+/**
+ * @brief Algorithm of an instrumented call (ERR_STATS)
+ */
+typedef enum
+{
+  ERR_ALGO_CHECKSUM8  = 0,   ///< checkSum8
+  ERR_ALGO_CHECKSUM16 = 1,   ///< checkSum16
+  ERR_ALGO_CHECKSUM32 = 2,   ///< checkSum32
+  ERR_ALGO_FLETCHER16 = 3,   ///< Fletcher-16
+  ERR_ALGO_FLETCHER32 = 4,   ///< Fletcher-32
+  ERR_ALGO_ADLER32    = 5,   ///< Adler-32
+  ERR_ALGO_INET       = 6,   ///< Internet checksum
+  ERR_ALGO_CRC8       = 7,   ///< CRC8
+  ERR_ALGO_CRC16      = 8,   ///< CRC16
+  ERR_ALGO_CRC32      = 9,   ///< CRC32
+  ERR_ALGO_CRCN       = 10,  ///< Generic CRC (CRC-3 to CRC-64)
+  ERR_ALGO_COUNT      = 11   ///< Number of algorithms
+} errAlgo_T;
+
+/**
+ * @brief Counters of one algorithm or kernel (ERR_STATS)
+ */
+typedef struct 
+{
+  uint64_t Calls;          ///< Instrumented calls
+  uint64_t Bytes;          ///< Bytes processed
+  uint64_t Cycles;         ///< Cycles spent (ERR_STATS_CYCLES ticks), 0 without a counter
+} errStatsCounter_T;
+
+/**
+ * @brief Snapshot of the instrumentation counters (ERR_STATS)
+ * @details Every instrumented call adds to its algorithm and to its kernel,
+ *          so both arrays hold the same totals split two ways.
+ */
+typedef struct 
+{
+  errStatsCounter_T Algo[ERR_ALGO_COUNT];       ///< Per algorithm (errAlgo_T)
+  errStatsCounter_T Kernel[ERR_KERNEL_COUNT];   ///< Per kernel (errKernel_T)
+  uint64_t Verified;       ///< Frames checked by CRCxx_Verify / CRCxx_TableVerify / errPipe_Feed
+  uint64_t Mismatches;     ///< Checked frames whose CRC did not match
+} errStats_T;
+
+/**
+ * @brief Buffer descriptor
+ * @details Points at one frame (or one fragment) of data for the batch functions
+ */
+typedef struct 
+{
+  uint8_t *Data;           ///< Pointer to data
+  size_t Length;           ///< Length of data in bytes
+} errBuffer_T;
+
+/**
+ * @brief CRC16 multi-stream context
+ * @details Runs up to ERR_MULTI_LANES independent CRC16 streams in lockstep.
+ *          The lanes share the table, so they share the polynomial and the
+ *          input reflection; Init, refOut and xorOut come from each lane's
+ *          own configuration.
+ */
+typedef struct 
+{
+  hcrc16Table_T *htable;               ///< Shared table context (CRC16_TableInit)
+  hcrc16_T *hcrc[ERR_MULTI_LANES];     ///< Configuration of each lane
+  uint16_t Reg[ERR_MULTI_LANES];       ///< Running CRC register of each lane (reflected order when refIn is set)
+  uint8_t Lanes;                       ///< Number of lanes in use
+} hcrc16Multi_T;
+
+/**
+ * @brief Fletcher-16 streaming context
+ */
+typedef struct 
+{
+  uint16_t Sum1;           ///< Running sum of the bytes (mod 255)
+  uint16_t Sum2;           ///< Running sum of Sum1 (mod 255)
+} hfletcher16Ctx_T;
+
+/**
+ * @brief Fletcher-32 streaming context
+ * @details Keeps the low byte of a 16-bit word cut by a fragment boundary
+ */
+typedef struct 
+{
+  uint32_t Sum1;           ///< Running sum of the 16-bit words (mod 65535)
+  uint32_t Sum2;           ///< Running sum of Sum1 (mod 65535)
+  uint8_t Byte;            ///< Pending low byte when Odd is set
+  bool Odd;                ///< true when an odd number of bytes was fed
+} hfletcher32Ctx_T;
+
+/**
+ * @brief Adler-32 streaming context
+ */
+typedef struct 
+{
+  uint32_t Sum1;           ///< Running sum of the bytes plus one (mod 65521)
+  uint32_t Sum2;           ///< Running sum of Sum1 (mod 65521)
+} hadler32Ctx_T;
+
+/**
+ * @brief Internet checksum (RFC 1071) streaming context
+ */
+typedef struct 
+{
+  uint32_t Sum;            ///< Running one's-complement sum of the 16-bit words
+  bool Odd;                ///< true when an odd number of bytes was fed
+} hcheckSumInetCtx_T;
+
+/**
+ * @brief Reflect (reverse) the low bits of a value
+ * @param _data Input data to be reflected
+ * @param _dataBits Number of bits to reflect (1 to 32; 0 is not allowed)
+ * @return uint32_t Bit-reflected output
+ */
+uint32_t bitReflected(uint32_t _data, uint8_t _dataBits);
+
 /**
  * @brief Calculate 8-bit checksum
  * @param _data Pointer to input data array
@@ -108,4 +769,1263 @@ uint16_t CRC16_Calc(hcrc16_T *hcrc, uint8_t *_data, uint16_t _dataLength);
  */
 uint32_t CRC32_Calc(hcrc32_T *hcrc, uint8_t *_data, uint16_t _dataLength);
 
+/**
+ * @brief Calculate 8-bit checksum for a buffer of any size
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint8_t Calculated 8-bit checksum value
+ */
+uint8_t checkSum8_CalcLarge(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 16-bit checksum for a buffer of any size
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint16_t Calculated 16-bit checksum value
+ */
+uint16_t checkSum16_CalcLarge(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 32-bit checksum for a buffer of any size
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint32_t Calculated 32-bit checksum value
+ */
+uint32_t checkSum32_CalcLarge(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate Fletcher-16 checksum
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Fletcher-16 value (Sum2 << 8 | Sum1)
+ */
+uint16_t Fletcher16_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start a Fletcher-16 calculation
+ * @param hctx Pointer to Fletcher-16 streaming context
+ */
+void Fletcher16_Init(hfletcher16Ctx_T *hctx);
+
+/**
+ * @brief Feed the next fragment into a Fletcher-16 calculation
+ * @param hctx Pointer to Fletcher-16 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void Fletcher16_Update(hfletcher16Ctx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Return the Fletcher-16 of all fragments fed so far
+ * @param hctx Pointer to Fletcher-16 streaming context
+ * @return uint16_t Fletcher-16 value (same as Fletcher16_Calc over all fragments)
+ */
+uint16_t Fletcher16_Final(hfletcher16Ctx_T *hctx);
+
+/**
+ * @brief Calculate Fletcher-32 checksum
+ * @param _data Pointer to input data array (16-bit little endian words)
+ * @param _dataLength Length of data in bytes (an odd last byte is padded with 0x00)
+ * @return uint32_t Fletcher-32 value (Sum2 << 16 | Sum1)
+ */
+uint32_t Fletcher32_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start a Fletcher-32 calculation
+ * @param hctx Pointer to Fletcher-32 streaming context
+ */
+void Fletcher32_Init(hfletcher32Ctx_T *hctx);
+
+/**
+ * @brief Feed the next fragment into a Fletcher-32 calculation
+ * @param hctx Pointer to Fletcher-32 streaming context
+ * @param _data Pointer to fragment data (any length, odd lengths allowed)
+ * @param _dataLength Length of fragment in bytes
+ */
+void Fletcher32_Update(hfletcher32Ctx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Return the Fletcher-32 of all fragments fed so far
+ * @param hctx Pointer to Fletcher-32 streaming context
+ * @return uint32_t Fletcher-32 value (same as Fletcher32_Calc over all fragments)
+ */
+uint32_t Fletcher32_Final(hfletcher32Ctx_T *hctx);
+
+/**
+ * @brief Calculate Adler-32 checksum (RFC 1950, zlib)
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Adler-32 value (Sum2 << 16 | Sum1)
+ */
+uint32_t Adler32_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start an Adler-32 calculation
+ * @param hctx Pointer to Adler-32 streaming context
+ */
+void Adler32_Init(hadler32Ctx_T *hctx);
+
+/**
+ * @brief Feed the next fragment into an Adler-32 calculation
+ * @param hctx Pointer to Adler-32 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void Adler32_Update(hadler32Ctx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Return the Adler-32 of all fragments fed so far
+ * @param hctx Pointer to Adler-32 streaming context
+ * @return uint32_t Adler-32 value (same as Adler32_Calc over all fragments)
+ */
+uint32_t Adler32_Final(hadler32Ctx_T *hctx);
+
+/**
+ * @brief Calculate the Internet checksum (RFC 1071, IPv4/UDP/TCP/ICMP)
+ * @param _data Pointer to input data array (16-bit big endian words)
+ * @param _dataLength Length of data in bytes (an odd last byte is padded with 0x00)
+ * @return uint16_t One's complement of the one's-complement sum, to be stored MSB first
+ */
+uint16_t checkSumInet_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start an Internet checksum calculation
+ * @param hctx Pointer to Internet checksum streaming context
+ */
+void checkSumInet_Init(hcheckSumInetCtx_T *hctx);
+
+/**
+ * @brief Feed the next fragment into an Internet checksum calculation
+ * @param hctx Pointer to Internet checksum streaming context
+ * @param _data Pointer to fragment data (any length, odd lengths allowed)
+ * @param _dataLength Length of fragment in bytes
+ */
+void checkSumInet_Update(hcheckSumInetCtx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Return the Internet checksum of all fragments fed so far
+ * @param hctx Pointer to Internet checksum streaming context
+ * @return uint16_t Internet checksum (same as checkSumInet_Calc over all fragments)
+ */
+uint16_t checkSumInet_Final(hcheckSumInetCtx_T *hctx);
+
+/**
+ * @brief Calculate 8-bit CRC value for a buffer of any size
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint8_t Calculated 8-bit CRC value
+ */
+uint8_t CRC8_CalcLarge(hcrc8_T *hcrc, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 16-bit CRC value for a buffer of any size
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint16_t Calculated 16-bit CRC value
+ */
+uint16_t CRC16_CalcLarge(hcrc16_T *hcrc, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 32-bit CRC value for a buffer of any size
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes (size_t, no 64 KB limit)
+ * @return uint32_t Calculated 32-bit CRC value
+ */
+uint32_t CRC32_CalcLarge(hcrc32_T *hcrc, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Build the CRC8 lookup table for a configuration
+ * @param htable Pointer to CRC8 table context to fill
+ * @param hcrc Pointer to CRC8 configuration structure
+ */
+void CRC8_TableInit(hcrc8Table_T *htable, hcrc8_T *hcrc);
+
+/**
+ * @brief Build the CRC16 lookup table for a configuration
+ * @param htable Pointer to CRC16 table context to fill
+ * @param hcrc Pointer to CRC16 configuration structure
+ */
+void CRC16_TableInit(hcrc16Table_T *htable, hcrc16_T *hcrc);
+
+/**
+ * @brief Build the CRC32 lookup table for a configuration
+ * @param htable Pointer to CRC32 table context to fill
+ * @param hcrc Pointer to CRC32 configuration structure
+ */
+void CRC32_TableInit(hcrc32Table_T *htable, hcrc32_T *hcrc);
+
+/**
+ * @brief Calculate 8-bit CRC value using a lookup table
+ * @param htable Pointer to CRC8 table context built by CRC8_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated 8-bit CRC value (same as CRC8_Calc)
+ */
+uint8_t CRC8_TableCalc(hcrc8Table_T *htable, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 16-bit CRC value using a lookup table
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated 16-bit CRC value (same as CRC16_Calc)
+ */
+uint16_t CRC16_TableCalc(hcrc16Table_T *htable, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 32-bit CRC value using a lookup table
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated 32-bit CRC value (same as CRC32_Calc)
+ */
+uint32_t CRC32_TableCalc(hcrc32Table_T *htable, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Build the CRC32 slicing-by-N tables for a configuration
+ * @param hslice Pointer to CRC32 slicing context to fill
+ * @param hcrc Pointer to CRC32 configuration structure
+ */
+void CRC32_SliceInit(hcrc32Slice_T *hslice, hcrc32_T *hcrc);
+
+/**
+ * @brief Calculate 32-bit CRC value processing CRC32_SLICE_N bytes per iteration
+ * @param hslice Pointer to CRC32 slicing context built by CRC32_SliceInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated 32-bit CRC value (same as CRC32_Calc)
+ */
+uint32_t CRC32_SliceCalc(hcrc32Slice_T *hslice, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Build the CRC8 nibble table for given configuration
+ * @param hnibble Pointer to CRC8 nibble table context to fill
+ * @param hcrc Pointer to CRC8 configuration structure
+ */
+void CRC8_NibbleInit(hcrc8Nibble_T *hnibble, hcrc8_T *hcrc);
+
+/**
+ * @brief Build the CRC16 nibble table for given configuration
+ * @param hnibble Pointer to CRC16 nibble table context to fill
+ * @param hcrc Pointer to CRC16 configuration structure
+ */
+void CRC16_NibbleInit(hcrc16Nibble_T *hnibble, hcrc16_T *hcrc);
+
+/**
+ * @brief Build the CRC32 nibble table for given configuration
+ * @param hnibble Pointer to CRC32 nibble table context to fill
+ * @param hcrc Pointer to CRC32 configuration structure
+ */
+void CRC32_NibbleInit(hcrc32Nibble_T *hnibble, hcrc32_T *hcrc);
+
+/**
+ * @brief Calculate 8-bit CRC value with two 16-entry table lookups per byte
+ * @param hnibble Pointer to CRC8 nibble table context built by CRC8_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated CRC value (same as CRC8_Calc)
+ */
+uint8_t CRC8_NibbleCalc(hcrc8Nibble_T *hnibble, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 16-bit CRC value with two 16-entry table lookups per byte
+ * @param hnibble Pointer to CRC16 nibble table context built by CRC16_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated CRC value (same as CRC16_Calc)
+ */
+uint16_t CRC16_NibbleCalc(hcrc16Nibble_T *hnibble, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 32-bit CRC value with two 16-entry table lookups per byte
+ * @param hnibble Pointer to CRC32 nibble table context built by CRC32_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated CRC value (same as CRC32_Calc)
+ */
+uint32_t CRC32_NibbleCalc(hcrc32Nibble_T *hnibble, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start a streaming CRC8 calculation with the bitwise engine
+ * @param hctx Pointer to CRC8 streaming context to initialize
+ * @param hcrc Pointer to CRC8 configuration structure (must stay valid)
+ */
+void CRC8_Init(hcrc8Ctx_T *hctx, hcrc8_T *hcrc);
+
+/**
+ * @brief Start a streaming CRC16 calculation with the bitwise engine
+ * @param hctx Pointer to CRC16 streaming context to initialize
+ * @param hcrc Pointer to CRC16 configuration structure (must stay valid)
+ */
+void CRC16_Init(hcrc16Ctx_T *hctx, hcrc16_T *hcrc);
+
+/**
+ * @brief Start a streaming CRC32 calculation with the bitwise engine
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param hcrc Pointer to CRC32 configuration structure (must stay valid)
+ */
+void CRC32_Init(hcrc32Ctx_T *hctx, hcrc32_T *hcrc);
+
+/**
+ * @brief Start a streaming CRC8 calculation with the table engine
+ * @param hctx Pointer to CRC8 streaming context to initialize
+ * @param htable Pointer to CRC8 table context (must stay valid)
+ */
+void CRC8_InitTable(hcrc8Ctx_T *hctx, hcrc8Table_T *htable);
+
+/**
+ * @brief Start a streaming CRC16 calculation with the table engine
+ * @param hctx Pointer to CRC16 streaming context to initialize
+ * @param htable Pointer to CRC16 table context (must stay valid)
+ */
+void CRC16_InitTable(hcrc16Ctx_T *hctx, hcrc16Table_T *htable);
+
+/**
+ * @brief Start a streaming CRC32 calculation with the table engine
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param htable Pointer to CRC32 table context (must stay valid)
+ */
+void CRC32_InitTable(hcrc32Ctx_T *hctx, hcrc32Table_T *htable);
+
+/**
+ * @brief Start a streaming CRC32 calculation with the slicing-by-N engine
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param hslice Pointer to CRC32 slicing context (must stay valid)
+ */
+void CRC32_InitSlice(hcrc32Ctx_T *hctx, hcrc32Slice_T *hslice);
+
+/**
+ * @brief Get the shared table of a CRC8 configuration, building it on first use
+ * @param hcrc Pointer to CRC8 configuration structure (only Poly and refIn are used)
+ * @return const hcrc8Table_T* Cached table (Config holds Poly/refIn only), or NULL when the cache is full or disabled
+ */
+const hcrc8Table_T *CRC8_TableGet(hcrc8_T *hcrc);
+
+/**
+ * @brief Get the shared table of a CRC16 configuration, building it on first use
+ * @param hcrc Pointer to CRC16 configuration structure (only Poly and refIn are used)
+ * @return const hcrc16Table_T* Cached table (Config holds Poly/refIn only), or NULL when the cache is full or disabled
+ */
+const hcrc16Table_T *CRC16_TableGet(hcrc16_T *hcrc);
+
+/**
+ * @brief Get the shared table of a CRC32 configuration, building it on first use
+ * @param hcrc Pointer to CRC32 configuration structure (only Poly and refIn are used)
+ * @return const hcrc32Table_T* Cached table (Config holds Poly/refIn only), or NULL when the cache is full or disabled
+ */
+const hcrc32Table_T *CRC32_TableGet(hcrc32_T *hcrc);
+
+/**
+ * @brief Calculate 8-bit CRC with the cached table of its configuration
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Calculated CRC value (same as CRC8_Calc)
+ */
+uint8_t CRC8_CachedCalc(hcrc8_T *hcrc, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 16-bit CRC with the cached table of its configuration
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Calculated CRC value (same as CRC16_Calc)
+ */
+uint16_t CRC16_CachedCalc(hcrc16_T *hcrc, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate 32-bit CRC with the cached table of its configuration
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Calculated CRC value (same as CRC32_Calc)
+ */
+uint32_t CRC32_CachedCalc(hcrc32_T *hcrc, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start a streaming CRC8 calculation with the cached table of its configuration
+ * @param hctx Pointer to CRC8 streaming context to initialize
+ * @param hcrc Pointer to CRC8 configuration structure (must stay valid)
+ */
+void CRC8_InitCached(hcrc8Ctx_T *hctx, hcrc8_T *hcrc);
+
+/**
+ * @brief Start a streaming CRC16 calculation with the cached table of its configuration
+ * @param hctx Pointer to CRC16 streaming context to initialize
+ * @param hcrc Pointer to CRC16 configuration structure (must stay valid)
+ */
+void CRC16_InitCached(hcrc16Ctx_T *hctx, hcrc16_T *hcrc);
+
+/**
+ * @brief Start a streaming CRC32 calculation with the cached table of its configuration
+ * @param hctx Pointer to CRC32 streaming context to initialize
+ * @param hcrc Pointer to CRC32 configuration structure (must stay valid)
+ */
+void CRC32_InitCached(hcrc32Ctx_T *hctx, hcrc32_T *hcrc);
+
+/**
+ * @brief Feed the next fragment of a message into a streaming CRC8 calculation
+ * @param hctx Pointer to CRC8 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void CRC8_Update(hcrc8Ctx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Feed the next fragment of a message into a streaming CRC16 calculation
+ * @param hctx Pointer to CRC16 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void CRC16_Update(hcrc16Ctx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Feed the next fragment of a message into a streaming CRC32 calculation
+ * @param hctx Pointer to CRC32 streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void CRC32_Update(hcrc32Ctx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Finish a streaming CRC8 calculation
+ * @param hctx Pointer to CRC8 streaming context
+ * @return uint8_t CRC8 of all fragments fed so far (xorOut/refOut applied)
+ */
+uint8_t CRC8_Final(hcrc8Ctx_T *hctx);
+
+/**
+ * @brief Finish a streaming CRC16 calculation
+ * @param hctx Pointer to CRC16 streaming context
+ * @return uint16_t CRC16 of all fragments fed so far (xorOut/refOut applied)
+ */
+uint16_t CRC16_Final(hcrc16Ctx_T *hctx);
+
+/**
+ * @brief Finish a streaming CRC32 calculation
+ * @param hctx Pointer to CRC32 streaming context
+ * @return uint32_t CRC32 of all fragments fed so far (xorOut/refOut applied)
+ */
+uint32_t CRC32_Final(hcrc32Ctx_T *hctx);
+
+/**
+ * @brief Feed one byte into a streaming CRC8 calculation (ISR-safe, inline)
+ * @param hctx Pointer to CRC8 streaming context started with CRC8_InitTable
+ *             (or CRC8_InitCached)
+ * @param _byte Received byte
+ * 
+ * @note One table read and one XOR per byte, with no branch on the data:
+ *       the cycle count is the same for every byte and every CRC8
+ *       configuration (measure it with Tools/err_bench.c in DWT mode).
+ *       Contexts without a table fall back to CRC8_Update.
+ *       A frame can be started in an ISR and finished with CRC8_Final
+ *       in the main loop once the ISR has stored the last byte.
+ */
+static inline void CRC8_UpdateByte(hcrc8Ctx_T *hctx, uint8_t _byte)
+{
+    if(hctx->htable == NULL)
+    {
+        CRC8_Update(hctx, &_byte, 1);
+        return;
+    };
+
+    hctx->Reg = hctx->htable->Table[(uint8_t)(hctx->Reg ^ _byte)];
+};
+
+/**
+ * @brief Feed one byte into a streaming CRC16 calculation (ISR-safe, inline)
+ * @param hctx Pointer to CRC16 streaming context started with CRC16_InitTable
+ *             (or CRC16_InitCached)
+ * @param _byte Received byte
+ * 
+ * @note One table read, one 8-bit shift and two XORs per byte, with no
+ *       branch on the data: the cycle count is the same for every byte
+ *       (the refIn test only depends on the configuration).
+ *       Contexts without a table fall back to CRC16_Update.
+ *       A frame can be started in an ISR and finished with CRC16_Final
+ *       in the main loop once the ISR has stored the last byte.
+ */
+static inline void CRC16_UpdateByte(hcrc16Ctx_T *hctx, uint8_t _byte)
+{
+    uint16_t _Reg = hctx->Reg;
+
+    if(hctx->htable == NULL)
+    {
+        CRC16_Update(hctx, &_byte, 1);
+        return;
+    };
+
+    if(hctx->hcrc->refIn)
+    {
+        _Reg = (uint16_t)((_Reg >> 8) ^ hctx->htable->Table[(uint8_t)(_Reg ^ _byte)]);
+    }
+    else
+    {
+        _Reg = (uint16_t)((_Reg << 8) ^ hctx->htable->Table[(uint8_t)((_Reg >> 8) ^ _byte)]);
+    };
+
+    hctx->Reg = _Reg;
+};
+
+/**
+ * @brief Feed one byte into a streaming CRC32 calculation (ISR-safe, inline)
+ * @param hctx Pointer to CRC32 streaming context started with CRC32_InitTable
+ *             (or CRC32_InitCached)
+ * @param _byte Received byte
+ * 
+ * @note One table read, one 8-bit shift and two XORs per byte, with no
+ *       branch on the data: the cycle count is the same for every byte
+ *       (the refIn test only depends on the configuration).
+ *       Contexts without a table (bitwise or slicing) fall back to CRC32_Update.
+ *       A frame can be started in an ISR and finished with CRC32_Final
+ *       in the main loop once the ISR has stored the last byte.
+ */
+static inline void CRC32_UpdateByte(hcrc32Ctx_T *hctx, uint8_t _byte)
+{
+    uint32_t _Reg = hctx->Reg;
+
+    if(hctx->htable == NULL)
+    {
+        CRC32_Update(hctx, &_byte, 1);
+        return;
+    };
+
+    if(hctx->hcrc->refIn)
+    {
+        _Reg = (_Reg >> 8) ^ hctx->htable->Table[(uint8_t)(_Reg ^ _byte)];
+    }
+    else
+    {
+        _Reg = (_Reg << 8) ^ hctx->htable->Table[(uint8_t)((_Reg >> 24) ^ _byte)];
+    };
+
+    hctx->Reg = _Reg;
+};
+
+/**
+ * @brief Calculate a CRC of any width (3 to 64 bits)
+ * @param hcrc Pointer to generic CRC configuration structure
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t Calculated CRC value (low Width bits)
+ * 
+ * @note Width 8, 16 and 32 give the same results as CRC8/16/32_CalcLarge.
+ *       Widths up to 32 run on the 32-bit register kernel, so CRC-5,
+ *       CRC-15, CRC-24, ... cost no 64-bit arithmetic on small MCUs.
+ */
+uint64_t CRCN_Calc(hcrcN_T *hcrc, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Build the lookup table of a generic CRC configuration
+ * @param htable Pointer to generic CRC table context to fill
+ * @param hcrc Pointer to generic CRC configuration structure
+ */
+void CRCN_TableInit(hcrcNTable_T *htable, hcrcN_T *hcrc);
+
+/**
+ * @brief Calculate a CRC of any width using a lookup table
+ * @param htable Pointer to generic CRC table context built by CRCN_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t Calculated CRC value (same as CRCN_Calc)
+ */
+uint64_t CRCN_TableCalc(hcrcNTable_T *htable, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Build the nibble table of a generic CRC configuration
+ * @param hnibble Pointer to generic CRC nibble table context to fill
+ * @param hcrc Pointer to generic CRC configuration structure
+ */
+void CRCN_NibbleInit(hcrcNNibble_T *hnibble, hcrcN_T *hcrc);
+
+/**
+ * @brief Calculate a CRC of any width with two 16-entry table lookups per byte
+ * @param hnibble Pointer to generic CRC nibble table context built by CRCN_NibbleInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t Calculated CRC value (same as CRCN_Calc)
+ */
+uint64_t CRCN_NibbleCalc(hcrcNNibble_T *hnibble, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start a streaming generic CRC calculation with the bitwise engine
+ * @param hctx Pointer to generic CRC streaming context to initialize
+ * @param hcrc Pointer to generic CRC configuration structure (must stay valid)
+ */
+void CRCN_Init(hcrcNCtx_T *hctx, hcrcN_T *hcrc);
+
+/**
+ * @brief Start a streaming generic CRC calculation with the table engine
+ * @param hctx Pointer to generic CRC streaming context to initialize
+ * @param htable Pointer to table context built by CRCN_TableInit (must stay valid)
+ */
+void CRCN_InitTable(hcrcNCtx_T *hctx, hcrcNTable_T *htable);
+
+/**
+ * @brief Feed the next fragment into a streaming generic CRC calculation
+ * @param hctx Pointer to generic CRC streaming context
+ * @param _data Pointer to fragment data
+ * @param _dataLength Length of fragment in bytes
+ */
+void CRCN_Update(hcrcNCtx_T *hctx, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Finish a streaming generic CRC calculation
+ * @param hctx Pointer to generic CRC streaming context
+ * @return uint64_t CRC of all fragments fed so far (xorOut/refOut applied)
+ */
+uint64_t CRCN_Final(hcrcNCtx_T *hctx);
+
+/**
+ * @brief Feed a chain of buffer segments into a streaming CRC8 calculation
+ * @param hctx Pointer to CRC8 streaming context
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ */
+void CRC8_UpdateSG(hcrc8Ctx_T *hctx, errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Feed a chain of buffer segments into a streaming CRC16 calculation
+ * @param hctx Pointer to CRC16 streaming context
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ */
+void CRC16_UpdateSG(hcrc16Ctx_T *hctx, errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Feed a chain of buffer segments into a streaming CRC32 calculation
+ * @param hctx Pointer to CRC32 streaming context
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ */
+void CRC32_UpdateSG(hcrc32Ctx_T *hctx, errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Calculate 8-bit CRC value of a chain of buffer segments
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * @return uint8_t CRC8 of the concatenated segments
+ * 
+ * @note Uses the cached table, or the bitwise engine when the cache is full.
+ */
+uint8_t CRC8_CalcSG(hcrc8_T *hcrc, errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Calculate 16-bit CRC value of a chain of buffer segments
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * @return uint16_t CRC16 of the concatenated segments
+ * 
+ * @note Uses the cached table, or the bitwise engine when the cache is full.
+ */
+uint16_t CRC16_CalcSG(hcrc16_T *hcrc, errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Calculate 32-bit CRC value of a chain of buffer segments
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _segments Pointer to array of segment descriptors, in message order
+ * @param _count Number of segments
+ * @return uint32_t CRC32 of the concatenated segments
+ * 
+ * @note Uses the cached table, or the bitwise engine when the cache is full.
+ */
+uint32_t CRC32_CalcSG(hcrc32_T *hcrc, errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Calculate 8-bit checksum of a chain of buffer segments
+ * @param _segments Pointer to array of segment descriptors
+ * @param _count Number of segments
+ * @return uint8_t Checksum of the concatenated segments
+ */
+uint8_t checkSum8_CalcSG(errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Calculate 16-bit checksum of a chain of buffer segments
+ * @param _segments Pointer to array of segment descriptors
+ * @param _count Number of segments
+ * @return uint16_t Checksum of the concatenated segments
+ */
+uint16_t checkSum16_CalcSG(errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Calculate 32-bit checksum of a chain of buffer segments
+ * @param _segments Pointer to array of segment descriptors
+ * @param _count Number of segments
+ * @return uint32_t Checksum of the concatenated segments
+ */
+uint32_t checkSum32_CalcSG(errBuffer_T *_segments, size_t _count);
+
+/**
+ * @brief Merge the CRC8 values of two adjacent blocks
+ * @param _crcA CRC8 of the first block
+ * @param _crcB CRC8 of the second block
+ * @param _lengthB Length of the second block in bytes
+ * @param hcrc Pointer to CRC8 configuration used for both blocks
+ * @return uint8_t CRC8 of the first block followed by the second
+ */
+uint8_t CRC8_Combine(uint8_t _crcA, uint8_t _crcB, size_t _lengthB, hcrc8_T *hcrc);
+
+/**
+ * @brief Merge the CRC16 values of two adjacent blocks
+ * @param _crcA CRC16 of the first block
+ * @param _crcB CRC16 of the second block
+ * @param _lengthB Length of the second block in bytes
+ * @param hcrc Pointer to CRC16 configuration used for both blocks
+ * @return uint16_t CRC16 of the first block followed by the second
+ */
+uint16_t CRC16_Combine(uint16_t _crcA, uint16_t _crcB, size_t _lengthB, hcrc16_T *hcrc);
+
+/**
+ * @brief Merge the CRC32 values of two adjacent blocks
+ * @param _crcA CRC32 of the first block
+ * @param _crcB CRC32 of the second block
+ * @param _lengthB Length of the second block in bytes
+ * @param hcrc Pointer to CRC32 configuration used for both blocks
+ * @return uint32_t CRC32 of the first block followed by the second
+ */
+uint32_t CRC32_Combine(uint32_t _crcA, uint32_t _crcB, size_t _lengthB, hcrc32_T *hcrc);
+
+/**
+ * @brief Update a 8-bit checksum after a span of the data was rewritten in place
+ * @param _sum checkSum8_Calc result of the original data
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @return uint8_t Checksum of the modified data
+ */
+uint8_t checkSum8_Patch(uint8_t _sum, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength);
+
+/**
+ * @brief Update a 16-bit checksum after a span of the data was rewritten in place
+ * @param _sum checkSum16_Calc result of the original data
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @return uint16_t Checksum of the modified data
+ */
+uint16_t checkSum16_Patch(uint16_t _sum, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength);
+
+/**
+ * @brief Update a 32-bit checksum after a span of the data was rewritten in place
+ * @param _sum checkSum32_Calc result of the original data
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @return uint32_t Checksum of the modified data
+ */
+uint32_t checkSum32_Patch(uint32_t _sum, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength);
+
+/**
+ * @brief Update a CRC8 value after a span of the frame was rewritten in place
+ * @param _CRC CRC8 of the original frame
+ * @param _frameLength Length of the whole frame in bytes
+ * @param _offset Offset of the rewritten span in the frame
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @return uint8_t CRC8 of the modified frame
+ */
+uint8_t CRC8_Patch(uint8_t _CRC, size_t _frameLength, size_t _offset, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength, hcrc8_T *hcrc);
+
+/**
+ * @brief Update a CRC16 value after a span of the frame was rewritten in place
+ * @param _CRC CRC16 of the original frame
+ * @param _frameLength Length of the whole frame in bytes
+ * @param _offset Offset of the rewritten span in the frame
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @return uint16_t CRC16 of the modified frame
+ */
+uint16_t CRC16_Patch(uint16_t _CRC, size_t _frameLength, size_t _offset, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength, hcrc16_T *hcrc);
+
+/**
+ * @brief Update a CRC32 value after a span of the frame was rewritten in place
+ * @param _CRC CRC32 of the original frame
+ * @param _frameLength Length of the whole frame in bytes
+ * @param _offset Offset of the rewritten span in the frame
+ * @param _oldData Original bytes of the span
+ * @param _newData New bytes of the span
+ * @param _dataLength Length of the span in bytes
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @return uint32_t CRC32 of the modified frame
+ */
+uint32_t CRC32_Patch(uint32_t _CRC, size_t _frameLength, size_t _offset, uint8_t *_oldData, uint8_t *_newData, size_t _dataLength, hcrc32_T *hcrc);
+
+/**
+ * @brief Build the syndrome table of the CRC16 error-correction mode
+ * @param hfix Pointer to error-correction context
+ * @param htable Pointer to CRC16 table context of the link (must stay valid)
+ * @param _frameLength Length of payload plus 2-byte CRC in bytes (payload up to 8190 bytes)
+ * @param _burst Longest correctable burst in bits (1 to 8, 1 = single-bit errors only)
+ * @param _entries Storage for the syndrome hash table (must stay valid)
+ * @param _count Number of entries, at least ERR_FIX_ENTRIES(_frameLength - 2, 16, _burst)
+ * @return bool true when built, false for invalid parameters or too few entries
+ */
+bool CRC16_FixInit(hcrc16Fix_T *hfix, hcrc16Table_T *htable, size_t _frameLength, uint8_t _burst, hcrcFixEntry_T *_entries, size_t _count);
+
+/**
+ * @brief Verify a frame that ends with its CRC16 and correct a single error in place
+ * @param hfix Pointer to error-correction context built by CRC16_FixInit
+ * @param _frame Pointer to payload followed by the 2-byte CRC (FrameLength bytes)
+ * @param _endian Byte order of the CRC trailer
+ * @return errFix_T ERR_FIX_NONE, ERR_FIX_CORRECTED or ERR_FIX_FAILED
+ */
+errFix_T CRC16_Fix(hcrc16Fix_T *hfix, uint8_t *_frame, errEndian_T _endian);
+
+/**
+ * @brief Build the syndrome table of the CRC32 error-correction mode
+ * @param hfix Pointer to error-correction context
+ * @param htable Pointer to CRC32 table context of the link (must stay valid)
+ * @param _frameLength Length of payload plus 4-byte CRC in bytes (payload up to 8190 bytes)
+ * @param _burst Longest correctable burst in bits (1 to 8, 1 = single-bit errors only)
+ * @param _entries Storage for the syndrome hash table (must stay valid)
+ * @param _count Number of entries, at least ERR_FIX_ENTRIES(_frameLength - 4, 32, _burst)
+ * @return bool true when built, false for invalid parameters or too few entries
+ */
+bool CRC32_FixInit(hcrc32Fix_T *hfix, hcrc32Table_T *htable, size_t _frameLength, uint8_t _burst, hcrcFixEntry_T *_entries, size_t _count);
+
+/**
+ * @brief Verify a frame that ends with its CRC32 and correct a single error in place
+ * @param hfix Pointer to error-correction context built by CRC32_FixInit
+ * @param _frame Pointer to payload followed by the 4-byte CRC (FrameLength bytes)
+ * @param _endian Byte order of the CRC trailer
+ * @return errFix_T ERR_FIX_NONE, ERR_FIX_CORRECTED or ERR_FIX_FAILED
+ */
+errFix_T CRC32_Fix(hcrc32Fix_T *hfix, uint8_t *_frame, errEndian_T _endian);
+
+/**
+ * @brief Verify a frame that ends with its CRC8
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @param _frame Pointer to payload followed by the 1-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC8_Verify(hcrc8_T *hcrc, uint8_t *_frame, size_t _frameLength);
+
+/**
+ * @brief Verify a frame that ends with its CRC8 using a lookup table
+ * @param htable Pointer to CRC8 table context built by CRC8_TableInit
+ * @param _frame Pointer to payload followed by the 1-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC8_TableVerify(hcrc8Table_T *htable, uint8_t *_frame, size_t _frameLength);
+
+/**
+ * @brief Verify a frame that ends with its CRC16
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @param _frame Pointer to payload followed by the 2-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC16_Verify(hcrc16_T *hcrc, uint8_t *_frame, size_t _frameLength, errEndian_T _endian);
+
+/**
+ * @brief Verify a frame that ends with its CRC16 using a lookup table
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit
+ * @param _frame Pointer to payload followed by the 2-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC16_TableVerify(hcrc16Table_T *htable, uint8_t *_frame, size_t _frameLength, errEndian_T _endian);
+
+/**
+ * @brief Verify a frame that ends with its CRC32
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @param _frame Pointer to payload followed by the 4-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC32_Verify(hcrc32_T *hcrc, uint8_t *_frame, size_t _frameLength, errEndian_T _endian);
+
+/**
+ * @brief Verify a frame that ends with its CRC32 using a lookup table
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _frame Pointer to payload followed by the 4-byte CRC
+ * @param _frameLength Length of payload plus CRC in bytes
+ * @param _endian Byte order of the CRC trailer
+ * @return bool true when the trailing CRC matches the payload
+ */
+bool CRC32_TableVerify(hcrc32Table_T *htable, uint8_t *_frame, size_t _frameLength, errEndian_T _endian);
+
+/**
+ * @brief Initialize a receive-and-verify pipeline
+ * @param hpipe Pointer to pipeline context
+ * @param htable Pointer to CRC32 table context of the link (must stay valid)
+ * @param _frameLength Length of payload plus 4-byte CRC in bytes (at least 4)
+ * @param _endian Byte order of the CRC trailer
+ * @param _callback Function called with the result of every frame, or NULL
+ * @param _arg Argument passed to the callback
+ */
+void errPipe_Init(herrPipe_T *hpipe, hcrc32Table_T *htable, size_t _frameLength, errEndian_T _endian, errPipeCallback_T _callback, void *_arg);
+
+/**
+ * @brief Feed a received half-buffer into the pipeline
+ * @param hpipe Pointer to pipeline context
+ * @param _data Pointer to the half-buffer just filled by DMA
+ * @param _dataLength Length of the half-buffer in bytes
+ */
+void errPipe_Feed(herrPipe_T *hpipe, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Drop the partly received frame (after a DMA error or a line resync)
+ * @param hpipe Pointer to pipeline context
+ */
+void errPipe_Resync(herrPipe_T *hpipe);
+
+/**
+ * @brief Calculate the CRC8 of many frames in one call
+ * @param htable Pointer to CRC8 table context built by CRC8_TableInit
+ * @param _frames Pointer to array of frame descriptors
+ * @param _results Pointer to array receiving one CRC per frame
+ * @param _count Number of frames
+ * 
+ * @note Checksums have no batch form: checkSumxx_CalcLarge already fills
+ *       its SIMD accumulators from one frame, so call it once per frame.
+ */
+void CRC8_BatchCalc(hcrc8Table_T *htable, errBuffer_T *_frames, uint8_t *_results, size_t _count);
+
+/**
+ * @brief Calculate the CRC16 of many frames in one call
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit
+ * @param _frames Pointer to array of frame descriptors
+ * @param _results Pointer to array receiving one CRC per frame
+ * @param _count Number of frames
+ */
+void CRC16_BatchCalc(hcrc16Table_T *htable, errBuffer_T *_frames, uint16_t *_results, size_t _count);
+
+/**
+ * @brief Calculate the CRC32 of many frames in one call
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _frames Pointer to array of frame descriptors
+ * @param _results Pointer to array receiving one CRC per frame
+ * @param _count Number of frames
+ */
+void CRC32_BatchCalc(hcrc32Table_T *htable, errBuffer_T *_frames, uint32_t *_results, size_t _count);
+
+/**
+ * @brief Start a multi-stream CRC16 calculation
+ * @param hctx Pointer to CRC16 multi-stream context
+ * @param htable Pointer to CRC16 table context built by CRC16_TableInit
+ * @param _configs Array of one configuration per lane, or NULL to use the
+ *                 table's configuration on every lane
+ * @param _lanes Number of lanes (1..ERR_MULTI_LANES)
+ * @return bool false when _lanes is out of range or a lane's Poly / refIn
+ *         differs from the table's
+ */
+bool CRC16_MultiInit(hcrc16Multi_T *hctx, hcrc16Table_T *htable, hcrc16_T **_configs, uint8_t _lanes);
+
+/**
+ * @brief Restart one lane of a multi-stream CRC16 calculation (next frame of that stream)
+ * @param hctx Pointer to CRC16 multi-stream context
+ * @param _lane Lane index
+ */
+void CRC16_MultiReset(hcrc16Multi_T *hctx, uint8_t _lane);
+
+/**
+ * @brief Feed the next fragment of every lane into a multi-stream CRC16 calculation
+ * @param hctx Pointer to CRC16 multi-stream context
+ * @param _fragments Array of one fragment per lane (lengths may differ, 0 skips the lane)
+ */
+void CRC16_MultiUpdate(hcrc16Multi_T *hctx, errBuffer_T *_fragments);
+
+/**
+ * @brief Return the CRC16 of one lane of a multi-stream calculation
+ * @param hctx Pointer to CRC16 multi-stream context
+ * @param _lane Lane index
+ * @return uint16_t Final CRC value of all fragments fed to the lane so far
+ */
+uint16_t CRC16_MultiFinal(hcrc16Multi_T *hctx, uint8_t _lane);
+
+/**
+ * @brief Select the kernel behind a function family
+ * @param _family Function family (ERR_DISPATCH_xxx)
+ * @param _kernel Kernel to use from now on, ERR_KERNEL_AUTO for the default
+ * @return bool true when selected, false when the build or CPU lacks the
+ *         kernel (the previous selection is kept)
+ */
+bool err_KernelSet(errDispatch_T _family, errKernel_T _kernel);
+
+/**
+ * @brief Get the kernel behind a function family
+ * @param _family Function family (ERR_DISPATCH_xxx)
+ * @return errKernel_T Selected kernel (ERR_KERNEL_AUTO for the CRC default)
+ */
+errKernel_T err_KernelGet(errDispatch_T _family);
+
+/**
+ * @brief Check whether a kernel can be selected for a function family
+ * @param _family Function family (ERR_DISPATCH_xxx)
+ * @param _kernel Kernel to check
+ * @return bool true when err_KernelSet would accept it
+ */
+bool err_KernelAvailable(errDispatch_T _family, errKernel_T _kernel);
+
+/**
+ * @brief Get the name of a kernel
+ * @param _kernel Kernel
+ * @return const char* Lowercase name ("auto", "bitwise", "table", ...)
+ */
+const char *err_KernelName(errKernel_T _kernel);
+
+#if ERR_PRESETS
+
+/**
+ * @brief Calculate CRC-8/MAXIM with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Same value as CRC8_Calc with the CRC8_MAXIM preset
+ */
+uint8_t CRC8_MAXIM_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC-8/NRSC-5 with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Same value as CRC8_Calc with the CRC8_NRSC5 preset
+ */
+uint8_t CRC8_NRSC5_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC-8/ATM with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Same value as CRC8_Calc with the CRC8_ATM preset
+ */
+uint8_t CRC8_ATM_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC-8/SAE-J1850 with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint8_t Same value as CRC8_Calc with the CRC8_SAE_J1850 preset
+ */
+uint8_t CRC8_SAE_J1850_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC-16/MODBUS with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Same value as CRC16_Calc with the CRC16_MODBUS preset
+ */
+uint16_t CRC16_MODBUS_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC-16/CCITT-FALSE with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint16_t Same value as CRC16_Calc with the CRC16_CCITT_FALSE preset
+ */
+uint16_t CRC16_CCITT_FALSE_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC-32/ISO-HDLC (Ethernet) with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Same value as CRC32_Calc with the CRC32_ISO_HDLC preset
+ */
+uint32_t CRC32_ISO_HDLC_Calc(uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC-32C (Castagnoli) with a specialised ROM-table kernel
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Same value as CRC32_Calc with the CRC32C preset
+ * 
+ * @note Uses the CRC32 instructions when ERR_HW_CRC is enabled and the CPU
+ *       supports them.
+ */
+uint32_t CRC32C_Calc(uint8_t *_data, size_t _dataLength);
+
+#endif /* ERR_PRESETS */
+
+#if ERR_STATS
+/**
+ * @brief Read the instrumentation counters
+ * @param hstats Pointer to the structure receiving the snapshot
+ */
+void err_StatsGet(errStats_T *hstats);
+
+/**
+ * @brief Clear the instrumentation counters
+ */
+void err_StatsReset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+
+/**
+ * @brief Integer sequence used to expand constexpr tables (C++11)
+ */
+template <unsigned... _I> struct errSeq_T {};
+template <unsigned _N, unsigned... _I> struct errMakeSeq_T : errMakeSeq_T<_N - 1, _N - 1, _I...> {};
+template <unsigned... _I> struct errMakeSeq_T<0, _I...> { typedef errSeq_T<_I...> type; };
+
+/**
+ * @brief ROM table of a compile-time CRC engine, expanded from _Crc::Entry
+ */
+template <typename _Crc, typename _Seq> struct errCrcTable_T;
+template <typename _Crc, unsigned... _I> struct errCrcTable_T<_Crc, errSeq_T<_I...> >
+{
+    static const typename _Crc::value_T Table[sizeof...(_I)];
+};
+
+template <typename _Crc, unsigned... _I>
+const typename _Crc::value_T errCrcTable_T<_Crc, errSeq_T<_I...> >::Table[sizeof...(_I)] ERR_ROM = { _Crc::Entry(_I)... };
+
+/**
+ * @brief Compile-time CRC engine for a fixed configuration (C++11)
+ * @details Every parameter is a template argument, so the refIn/refOut
+ *          branches are resolved by the compiler and the 256-entry table
+ *          is generated at compile time into ROM (PROGMEM on AVR):
+ * @code
+ *          uint16_t _CRC = errCrc16Modbus_T::Calc(_frame, _frameLength);
+ *          static_assert(errCrc32_T::Const("123456789", 9) == 0xCBF43926, "CRC-32 check value");
+ * @endcode
+ * @tparam _Type Register type (uint8_t, uint16_t or uint32_t)
+ * @tparam _Poly, _Init, _refIn, _refOut, _xorOut Same meaning as in hcrcXX_T
+ */
+template <typename _Type, _Type _Poly, _Type _Init, bool _refIn, bool _refOut, _Type _xorOut>
+struct errCrc_T
+{
+    typedef _Type value_T;
+    typedef errCrcTable_T<errCrc_T, typename errMakeSeq_T<256>::type> table_T;
+
+    static constexpr unsigned Width = 8 * sizeof(_Type);
+
+    /**
+     * @brief Reverses the Width low bits of a value
+     */
+    static constexpr _Type Reflect(_Type _data, unsigned _bits = Width, _Type _result = 0)
+    {
+        return (_bits == 0) ? _result : Reflect((_Type)(_data >> 1), _bits - 1, (_Type)((_result << 1) | (_data & 0x01)));
+    };
+
+    /**
+     * @brief Shifts the register one bit through the polynomial
+     */
+    static constexpr _Type Step(_Type _CRC)
+    {
+        return _refIn ? (_Type)((_CRC & 0x01) ? ((_CRC >> 1) ^ Reflect(_Poly)) : (_CRC >> 1))
+                      : (_Type)(((_CRC >> (Width - 1)) & 0x01) ? ((_CRC << 1) ^ _Poly) : (_CRC << 1));
+    };
+
+    /**
+     * @brief Applies _bits bit steps to the register
+     */
+    static constexpr _Type Steps(_Type _CRC, unsigned _bits)
+    {
+        return (_bits == 0) ? _CRC : Steps(Step(_CRC), _bits - 1);
+    };
+
+    /**
+     * @brief Table entry for one input byte
+     */
+    static constexpr _Type Entry(unsigned _index)
+    {
+        return _refIn ? Steps((_Type)_index, 8) : Steps((_Type)((_Type)_index << (Width - 8)), 8);
+    };
+
+    /**
+     * @brief Initial register value (reflected order when refIn is set)
+     */
+    static constexpr _Type Start(void)
+    {
+        return _refIn ? Reflect(_Init) : _Init;
+    };
+
+    /**
+     * @brief Applies xorOut and refOut to a register
+     */
+    static constexpr _Type Final(_Type _CRC)
+    {
+        return _refIn ? (_refOut ? (_Type)(_CRC ^ Reflect(_xorOut)) : (_Type)(Reflect(_CRC) ^ _xorOut))
+                      : (_refOut ? Reflect((_Type)(_CRC ^ _xorOut)) : (_Type)(_CRC ^ _xorOut));
+    };
+
+    /**
+     * @brief Feeds one byte into the register (table-free, usable in constant expressions)
+     */
+    static constexpr _Type Byte(_Type _CRC, uint8_t _data)
+    {
+        return _refIn ? (_Type)((Width > 8 ? (_CRC >> 8) : 0) ^ Entry((uint8_t)(_CRC ^ _data)))
+                      : (_Type)((Width > 8 ? (_CRC << 8) : 0) ^ Entry((uint8_t)((_CRC >> (Width - 8)) ^ _data)));
+    };
+
+    /**
+     * @brief CRC of a constant string evaluated at compile time
+     * @param _data Pointer to constant character data (e.g. a string literal)
+     * @param _dataLength Length of data in bytes
+     * @return Final CRC value, same as Calc over the same bytes
+     * 
+     * @note One recursion level per byte; meant for short constants such as
+     *       command names or check values, not for buffers.
+     */
+    static constexpr _Type Const(const char *_data, size_t _dataLength, _Type _CRC = Start())
+    {
+        return (_dataLength == 0) ? Final(_CRC) : Const(_data + 1, _dataLength - 1, Byte(_CRC, (uint8_t)*_data));
+    };
+
+    /**
+     * @brief CRC of a buffer using the ROM table
+     * @param _data Pointer to input data array
+     * @param _dataLength Length of data in bytes
+     * @return Final CRC value (xorOut and refOut applied)
+     */
+    static _Type Calc(const uint8_t *_data, size_t _dataLength)
+    {
+        _Type _CRC = Start();
+
+        for(; _dataLength > 0; _dataLength--, _data++)
+        {
+            if(_refIn)
+            {
+                _CRC = (_Type)((Width > 8 ? (_CRC >> 8) : 0) ^ Read(&table_T::Table[(uint8_t)(_CRC ^ *_data)]));
+            }
+            else
+            {
+                _CRC = (_Type)((Width > 8 ? (_CRC << 8) : 0) ^ Read(&table_T::Table[(uint8_t)((_CRC >> (Width - 8)) ^ *_data)]));
+            };
+        };
+
+        return Final(_CRC);
+    };
+
+    /**
+     * @brief Reads one table entry from ROM
+     */
+    static _Type Read(const _Type *_entry)
+    {
+        return (sizeof(_Type) == 1) ? (_Type)ERR_ROM_READ8((const uint8_t *)_entry)
+             : (sizeof(_Type) == 2) ? (_Type)ERR_ROM_READ16((const uint16_t *)_entry)
+             : (_Type)ERR_ROM_READ32((const uint32_t *)_entry);
+    };
+};
+
+typedef errCrc_T<uint8_t,  0x31,       0x00,       true,  true,  0x00>       errCrc8Maxim_T;        ///< CRC-8/MAXIM
+typedef errCrc_T<uint8_t,  0x31,       0xFF,       false, false, 0x00>       errCrc8Nrsc5_T;        ///< CRC-8/NRSC-5
+typedef errCrc_T<uint8_t,  0x07,       0x00,       false, false, 0x00>       errCrc8Atm_T;          ///< CRC-8/ATM
+typedef errCrc_T<uint8_t,  0x1D,       0xFF,       false, false, 0xFF>       errCrc8SaeJ1850_T;     ///< CRC-8/SAE-J1850
+typedef errCrc_T<uint16_t, 0x8005,     0xFFFF,     true,  true,  0x0000>     errCrc16Modbus_T;      ///< CRC-16/MODBUS
+typedef errCrc_T<uint16_t, 0x1021,     0xFFFF,     false, false, 0x0000>     errCrc16CcittFalse_T;  ///< CRC-16/CCITT-FALSE
+typedef errCrc_T<uint32_t, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF> errCrc32_T;            ///< CRC-32/ISO-HDLC (Ethernet)
+typedef errCrc_T<uint32_t, 0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF> errCrc32c_T;           ///< CRC-32C (Castagnoli)
+
+#endif /* __cplusplus */
+
 #endif
\ No newline at end of file
@@ -0,0 +1,424 @@
+/**
+ * @file     err_host.c
+ * @brief    Error Detection Library - host (POSIX) extensions
+ * @note     Worker pool, multi-threaded and file CRC calculation for Linux/macOS hosts.
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     For detailed explanations, usage examples, and implementation notes,
+ *           please visit the repository:
+ *           https://github.com/aKaReZa75/Error_Detection
+ */
+#ifndef _DEFAULT_SOURCE
+  #define _DEFAULT_SOURCE   ///< madvise / posix_fadvise with -std=c99 on glibc
+#endif
+
+#include "err_host.h"
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+/**
+ * @brief CRC32_ParallelCalc job: one contiguous span per thread
+ */
+typedef struct
+{
+  hcrc32Table_T *htable;               ///< Table context shared by all threads
+  uint8_t *Data;                       ///< Start of the whole buffer
+  size_t Length;                       ///< Length of the whole buffer
+  size_t Chunk;                        ///< Bytes per span (the last one may be shorter)
+  uint32_t CRC[ERR_POOL_MAX_THREADS];  ///< Final CRC of every span
+} errCrc32Job_T;
+
+
+/**
+ * @brief Hands out work items of the current job until none is left
+ * @param hpool Pointer to pool context, Lock held on entry and on return
+ */
+static void errPool_Work(herrPool_T *hpool)
+{
+    size_t _index = 0x00;
+
+    while(hpool->Next < hpool->Count)
+    {
+        _index = hpool->Next++;
+
+        pthread_mutex_unlock(&hpool->Lock);
+        hpool->Job(hpool->Arg, _index);
+        pthread_mutex_lock(&hpool->Lock);
+
+        if(--hpool->Pending == 0)
+        {
+            pthread_cond_broadcast(&hpool->Done);
+        };
+    };
+};
+
+
+/**
+ * @brief Worker thread main loop
+ * @param _arg Pointer to pool context
+ * @return void* Always NULL
+ */
+static void *errPool_Thread(void *_arg)
+{
+    herrPool_T *hpool = (herrPool_T *)_arg;
+    uint32_t _Generation = 0x00;
+
+    pthread_mutex_lock(&hpool->Lock);
+    _Generation = hpool->Generation;
+
+    while(1)
+    {
+        while(!hpool->Quit && (hpool->Generation == _Generation))
+        {
+            pthread_cond_wait(&hpool->Start, &hpool->Lock);
+        };
+
+        if(hpool->Quit)
+        {
+            break;
+        };
+
+        _Generation = hpool->Generation;
+        errPool_Work(hpool);
+    };
+
+    pthread_mutex_unlock(&hpool->Lock);
+    return NULL;
+};
+
+
+/**
+ * @brief Starts a worker pool
+ * @param hpool Pointer to pool context to initialize
+ * @param _threads Threads working on a job including the caller (0 = online CPUs)
+ * @param _minChunk Minimum bytes per thread for CRC32_ParallelCalc (0 = ERR_POOL_MIN_CHUNK)
+ * @return bool true on success, false when the threads could not be started
+ *
+ * @note The thread count is clamped to ERR_POOL_MAX_THREADS. The caller of
+ *       errPool_Run is one of the threads, so _threads - 1 workers are started.
+ */
+bool errPool_Init(herrPool_T *hpool, uint16_t _threads, size_t _minChunk)
+{
+    long _online = 0x00;
+    uint16_t _index = 0x00;
+
+    if(_threads == 0)
+    {
+        _online = sysconf(_SC_NPROCESSORS_ONLN);
+        _threads = (_online < 1) ? 1 : ((_online > ERR_POOL_MAX_THREADS) ? ERR_POOL_MAX_THREADS : (uint16_t)_online);
+    };
+
+    if(_threads > ERR_POOL_MAX_THREADS)
+    {
+        _threads = ERR_POOL_MAX_THREADS;
+    };
+
+    hpool->Threads = 1;
+    hpool->MinChunk = (_minChunk == 0) ? ERR_POOL_MIN_CHUNK : _minChunk;
+    hpool->Job = NULL;
+    hpool->Arg = NULL;
+    hpool->Count = 0x00;
+    hpool->Next = 0x00;
+    hpool->Pending = 0x00;
+    hpool->Generation = 0x00;
+    hpool->Quit = false;
+
+    pthread_mutex_init(&hpool->Run, NULL);
+    pthread_mutex_init(&hpool->Lock, NULL);
+    pthread_cond_init(&hpool->Start, NULL);
+    pthread_cond_init(&hpool->Done, NULL);
+
+    for(_index = 1; _index < _threads; _index++)
+    {
+        if(pthread_create(&hpool->Thread[_index], NULL, errPool_Thread, hpool) != 0)
+        {
+            errPool_DeInit(hpool);
+            return false;
+        };
+        hpool->Threads++;
+    };
+
+    return true;
+};
+
+
+/**
+ * @brief Stops the worker threads of a pool
+ * @param hpool Pointer to pool context started by errPool_Init
+ */
+void errPool_DeInit(herrPool_T *hpool)
+{
+    uint16_t _index = 0x00;
+
+    pthread_mutex_lock(&hpool->Lock);
+    hpool->Quit = true;
+    pthread_cond_broadcast(&hpool->Start);
+    pthread_mutex_unlock(&hpool->Lock);
+
+    for(_index = 1; _index < hpool->Threads; _index++)
+    {
+        pthread_join(hpool->Thread[_index], NULL);
+    };
+
+    hpool->Threads = 1;
+
+    pthread_cond_destroy(&hpool->Done);
+    pthread_cond_destroy(&hpool->Start);
+    pthread_mutex_destroy(&hpool->Lock);
+    pthread_mutex_destroy(&hpool->Run);
+};
+
+
+/**
+ * @brief Runs a job on the pool and waits for it to finish
+ * @param hpool Pointer to pool context
+ * @param _job Function called once for every work item
+ * @param _arg Argument passed to every call of _job
+ * @param _count Number of work items
+ *
+ * @note Work items are handed out one at a time to the workers and the
+ *       calling thread. Calls from several threads are serialised.
+ */
+void errPool_Run(herrPool_T *hpool, errPoolJob_T _job, void *_arg, size_t _count)
+{
+    if(_count == 0)
+    {
+        return;
+    };
+
+    pthread_mutex_lock(&hpool->Run);
+    pthread_mutex_lock(&hpool->Lock);
+
+    hpool->Job = _job;
+    hpool->Arg = _arg;
+    hpool->Count = _count;
+    hpool->Next = 0x00;
+    hpool->Pending = _count;
+    hpool->Generation++;
+    pthread_cond_broadcast(&hpool->Start);
+
+    errPool_Work(hpool);
+
+    while(hpool->Pending > 0)
+    {
+        pthread_cond_wait(&hpool->Done, &hpool->Lock);
+    };
+
+    pthread_mutex_unlock(&hpool->Lock);
+    pthread_mutex_unlock(&hpool->Run);
+};
+
+
+/**
+ * @brief Calculates the CRC32 of one span of a CRC32_ParallelCalc job
+ * @param _arg Pointer to errCrc32Job_T
+ * @param _index Span index
+ */
+static void errPool_Crc32Span(void *_arg, size_t _index)
+{
+    errCrc32Job_T *_job = (errCrc32Job_T *)_arg;
+    size_t _offset = _index * _job->Chunk;
+    size_t _length = _job->Length - _offset;
+
+    if(_length > _job->Chunk)
+    {
+        _length = _job->Chunk;
+    };
+
+    _job->CRC[_index] = CRC32_TableCalc(_job->htable, _job->Data + _offset, _length);
+};
+
+
+/**
+ * @brief Calculates CRC32 of a large buffer on all threads of a pool
+ * @param hpool Pointer to pool context
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Same value as CRC32_TableCalc / CRC32_Calc
+ *
+ * @note The buffer is cut into one contiguous span per thread (at least
+ *       MinChunk bytes each); every span runs the fastest kernel of
+ *       CRC32_TableCalc (hardware CRC, carry-less folding or table) and the
+ *       span CRCs are merged in order with CRC32_Combine. CRC reads each byte
+ *       once, so one long span per thread streams as well as many small ones
+ *       and keeps the merge to Threads - 1 combines. The span count is
+ *       recomputed from the rounded-up span length, so no span starts past
+ *       the end of a short buffer. Buffers shorter than two chunks are
+ *       computed directly on the calling thread.
+ */
+uint32_t CRC32_ParallelCalc(herrPool_T *hpool, hcrc32Table_T *htable, uint8_t *_data, size_t _dataLength)
+{
+    errCrc32Job_T _job;
+    size_t _spans = 0x00;
+    size_t _index = 0x00;
+    size_t _length = 0x00;
+    uint32_t _CRC = 0x00;
+
+    _spans = _dataLength / hpool->MinChunk;
+    if(_spans > hpool->Threads)
+    {
+        _spans = hpool->Threads;
+    };
+
+    if(_spans < 2)
+    {
+        return CRC32_TableCalc(htable, _data, _dataLength);
+    };
+
+    _job.htable = htable;
+    _job.Data = _data;
+    _job.Length = _dataLength;
+    _job.Chunk = (_dataLength + _spans - 1) / _spans;
+    _spans = (_dataLength + _job.Chunk - 1) / _job.Chunk;
+
+    errPool_Run(hpool, errPool_Crc32Span, &_job, _spans);
+
+    _CRC = _job.CRC[0];
+    for(_index = 1; _index < _spans; _index++)
+    {
+        _length = _dataLength - (_index * _job.Chunk);
+        if(_length > _job.Chunk)
+        {
+            _length = _job.Chunk;
+        };
+
+        _CRC = CRC32_Combine(_CRC, _job.CRC[_index], _length, &htable->Config);
+    };
+
+    return _CRC;
+};
+
+
+/**
+ * @brief Calculates CRC32 of a file with read() into a fixed buffer
+ * @param htable Pointer to CRC32 table context
+ * @param _fd Open file descriptor positioned at the start
+ * @param _CRC Receives the CRC32 of the file contents
+ * @return bool true on success, false on a read or allocation error
+ */
+static bool errFile_Crc32Read(hcrc32Table_T *htable, int _fd, uint32_t *_CRC)
+{
+    hcrc32Ctx_T _ctx;
+    uint8_t *_buffer = NULL;
+    ssize_t _length = 0x00;
+
+    _buffer = (uint8_t *)malloc(ERR_FILE_BUFFER);
+    if(_buffer == NULL)
+    {
+        errno = ENOMEM;
+        return false;
+    };
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    CRC32_InitTable(&_ctx, htable);
+
+    while(1)
+    {
+        _length = read(_fd, _buffer, ERR_FILE_BUFFER);
+
+        if(_length > 0)
+        {
+            CRC32_Update(&_ctx, _buffer, (size_t)_length);
+        }
+        else if(_length == 0)
+        {
+            break;
+        }
+        else if(errno != EINTR)
+        {
+            free(_buffer);
+            return false;
+        };
+    };
+
+    free(_buffer);
+    *_CRC = CRC32_Final(&_ctx);
+    return true;
+};
+
+
+/**
+ * @brief Calculates CRC32 of a whole file
+ * @param hpool Pointer to pool context for a multi-threaded calculation, or NULL
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _path Path of the file (pipes and devices are accepted)
+ * @param _CRC Receives the CRC32 of the file contents
+ * @return bool true on success, false on an I/O error (errno is set)
+ *
+ * @note Regular files are mapped read-only with mmap and the kernel is told
+ *       the access is sequential (MADV_SEQUENTIAL), so read-ahead runs in
+ *       front of the CRC and no copy to a user buffer is made. The mapping
+ *       goes through CRC32_ParallelCalc when a pool is given and through
+ *       CRC32_TableCalc otherwise, so the fastest kernel sees the whole file.
+ *       Pipes, devices, empty files and files that cannot be mapped are
+ *       streamed with read() into an ERR_FILE_BUFFER buffer instead.
+ *       The result equals CRC32_TableCalc over the file contents.
+ */
+bool CRC32_FileCalc(herrPool_T *hpool, hcrc32Table_T *htable, const char *_path, uint32_t *_CRC)
+{
+    struct stat _stat;
+    uint8_t *_map = NULL;
+    bool _status = false;
+    int _error = 0x00;
+    int _fd = -1;
+
+    do
+    {
+        _fd = open(_path, O_RDONLY);
+    } while((_fd < 0) && (errno == EINTR));
+
+    if(_fd < 0)
+    {
+        return false;
+    };
+
+    if((fstat(_fd, &_stat) == 0) && S_ISREG(_stat.st_mode) && (_stat.st_size > 0) && ((uintmax_t)_stat.st_size <= SIZE_MAX))
+    {
+        _map = (uint8_t *)mmap(NULL, (size_t)_stat.st_size, PROT_READ, MAP_PRIVATE, _fd, 0);
+        if(_map == (uint8_t *)MAP_FAILED)
+        {
+            _map = NULL;
+        };
+    };
+
+    if(_map != NULL)
+    {
+#ifdef MADV_SEQUENTIAL
+        madvise(_map, (size_t)_stat.st_size, MADV_SEQUENTIAL);
+#endif
+
+        if(hpool != NULL)
+        {
+            *_CRC = CRC32_ParallelCalc(hpool, htable, _map, (size_t)_stat.st_size);
+        }
+        else
+        {
+            *_CRC = CRC32_TableCalc(htable, _map, (size_t)_stat.st_size);
+        };
+
+        munmap(_map, (size_t)_stat.st_size);
+        _status = true;
+    }
+    else
+    {
+        _status = errFile_Crc32Read(htable, _fd, _CRC);
+    };
+
+    _error = errno;
+    close(_fd);
+    errno = _error;
+
+    return _status;
+};
\ No newline at end of file
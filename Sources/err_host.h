@@ -0,0 +1,131 @@
+/**
+ * @file     err_host.h
+ * @brief    Error Detection Library - host (POSIX) extensions
+ * @note     Multi-threaded helpers for Linux/macOS hosts built on top of err.h.
+ *           This file needs POSIX threads and is not meant for microcontroller
+ *           builds; add err_host.c to the build and link with -lpthread.
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     For detailed explanations, usage examples, and implementation notes,
+ *           please visit the repository:
+ *           https://github.com/aKaReZa75/Error_Detection
+ */
+
+#ifndef _err_host_H_
+#define _err_host_H_
+
+#include "err.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of threads (including the caller) of a worker pool
+ */
+#ifndef ERR_POOL_MAX_THREADS
+  #define ERR_POOL_MAX_THREADS 64
+#endif
+
+#if (ERR_POOL_MAX_THREADS < 1) || (ERR_POOL_MAX_THREADS > 65535)
+  #error "ERR_POOL_MAX_THREADS must be between 1 and 65535"
+#endif
+
+/**
+ * @brief Default minimum number of bytes given to one thread
+ * @details Buffers shorter than two chunks are computed on the calling
+ *          thread, so short messages keep the single-threaded latency.
+ */
+#ifndef ERR_POOL_MIN_CHUNK
+  #define ERR_POOL_MIN_CHUNK (1024UL * 1024UL)
+#endif
+
+/**
+ * @brief Read buffer size of the streaming fallback of CRC32_FileCalc
+ */
+#ifndef ERR_FILE_BUFFER
+  #define ERR_FILE_BUFFER (1024UL * 1024UL)
+#endif
+
+/**
+ * @brief Job function run by the worker pool
+ * @param _arg Job argument passed to errPool_Run
+ * @param _index Index of the work item, from 0 to _count - 1
+ */
+typedef void (*errPoolJob_T)(void *_arg, size_t _index);
+
+/**
+ * @brief Worker pool context
+ * @details The worker threads are started once by errPool_Init and sleep
+ *          between jobs; the thread calling errPool_Run works as well.
+ */
+typedef struct
+{
+  pthread_t Thread[ERR_POOL_MAX_THREADS];   ///< Worker threads (Threads - 1 are started)
+  uint16_t Threads;                         ///< Threads working on a job, the caller included
+  size_t MinChunk;                          ///< Minimum bytes per thread for the parallel CRC
+  pthread_mutex_t Run;                      ///< Serialises errPool_Run calls
+  pthread_mutex_t Lock;                     ///< Protects the job state below
+  pthread_cond_t Start;                     ///< Signalled when a new job is posted
+  pthread_cond_t Done;                      ///< Signalled when the last work item finishes
+  errPoolJob_T Job;                         ///< Current job function
+  void *Arg;                                ///< Current job argument
+  size_t Count;                             ///< Work items of the current job
+  size_t Next;                              ///< Next work item to hand out
+  size_t Pending;                           ///< Work items not finished yet
+  uint32_t Generation;                      ///< Incremented for every job
+  bool Quit;                                ///< Set by errPool_DeInit
+} herrPool_T;
+
+/**
+ * @brief Start a worker pool
+ * @param hpool Pointer to pool context to initialize
+ * @param _threads Threads working on a job including the caller (0 = online CPUs)
+ * @param _minChunk Minimum bytes per thread for CRC32_ParallelCalc (0 = ERR_POOL_MIN_CHUNK)
+ * @return bool true on success, false when the threads could not be started
+ */
+bool errPool_Init(herrPool_T *hpool, uint16_t _threads, size_t _minChunk);
+
+/**
+ * @brief Stop the worker threads of a pool
+ * @param hpool Pointer to pool context started by errPool_Init
+ */
+void errPool_DeInit(herrPool_T *hpool);
+
+/**
+ * @brief Run a job on the pool and wait for it to finish
+ * @param hpool Pointer to pool context
+ * @param _job Function called once for every work item
+ * @param _arg Argument passed to every call of _job
+ * @param _count Number of work items
+ */
+void errPool_Run(herrPool_T *hpool, errPoolJob_T _job, void *_arg, size_t _count);
+
+/**
+ * @brief Calculate CRC32 of a large buffer on all threads of a pool
+ * @param hpool Pointer to pool context
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Same value as CRC32_TableCalc / CRC32_Calc
+ */
+uint32_t CRC32_ParallelCalc(herrPool_T *hpool, hcrc32Table_T *htable, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Calculate CRC32 of a whole file
+ * @param hpool Pointer to pool context for a multi-threaded calculation, or NULL
+ * @param htable Pointer to CRC32 table context built by CRC32_TableInit
+ * @param _path Path of the file (pipes and devices are accepted)
+ * @param _CRC Receives the CRC32 of the file contents
+ * @return bool true on success, false on an I/O error (errno is set)
+ */
+bool CRC32_FileCalc(herrPool_T *hpool, hcrc32Table_T *htable, const char *_path, uint32_t *_CRC);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,399 @@
+/**
+ * @file     err_stm32.c
+ * @brief    Error Detection Library - STM32 CRC peripheral backend
+ * @note     Programs the STM32 CRC unit from hcrc8_T/hcrc16_T/hcrc32_T
+ *           configurations and feeds it by CPU or DMA.
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     For detailed explanations, usage examples, and implementation notes,
+ *           please visit the repository:
+ *           https://github.com/aKaReZa75/Error_Detection
+ */
+#include "err_stm32.h"
+#include <string.h>
+
+#if defined(CRC) && defined(HAL_DMA_MODULE_ENABLED)
+
+/**
+ * @brief Largest DMA transfer in bytes (16-bit NDTR counter)
+ */
+#define ERR_STM32_DMA_MAX 0xFFFFU
+
+
+/**
+ * @brief Stores a configuration and checks whether the peripheral can run it
+ * @param hdev Pointer to CRC peripheral context
+ * @param _width CRC width (8, 16 or 32)
+ * @param _Poly Polynomial
+ * @param _Init Initial value
+ * @param _refIn Input reflection
+ * @param _refOut Output reflection
+ * @param _xorOut Final XOR value
+ * @return bool true when the peripheral computes the configuration, false when
+ *         software is used or a DMA calculation is running (nothing is changed)
+ *
+ * @note The peripheral shifts MSB-first with a normal-order register, reflects
+ *       each input byte when REV_IN is set to byte mode and loads INIT in the
+ *       normal domain, which is exactly how CRCxx_Calc defines the result.
+ *       Output reflection is not left to REV_OUT because the library applies
+ *       xorOut before reflecting; both are done on the read-back value.
+ *       Units without POLYSIZE (fixed 0x04C11DB7, 32-bit words only) and even
+ *       polynomials, which the unit does not support, use the software engines.
+ *       The registers are written by errCrcHw_Program at the start of every
+ *       calculation, so other users of the unit do not disturb this context.
+ */
+static bool errCrcHw_Config(herrCrcHw_T *hdev, uint8_t _width, uint32_t _Poly, uint32_t _Init, bool _refIn, bool _refOut, uint32_t _xorOut)
+{
+    if(hdev->Busy)
+    {
+        return false;
+    };
+
+    hdev->Width = _width;
+    hdev->Poly = _Poly;
+    hdev->Init = _Init;
+    hdev->refIn = _refIn;
+    hdev->refOut = _refOut;
+    hdev->xorOut = _xorOut;
+    hdev->Hardware = false;
+
+#if defined(CRC_CR_POLYSIZE)
+    hdev->Hardware = bitCheckHigh(_Poly, 0);
+#endif
+
+    return hdev->Hardware;
+};
+
+
+/**
+ * @brief Loads the context configuration into the peripheral and resets it
+ * @param hdev Pointer to CRC peripheral context
+ *
+ * @note POL and INIT are written before CR so that the RESET bit loads the
+ *       new INIT value into DR.
+ */
+static void errCrcHw_Program(herrCrcHw_T *hdev)
+{
+#if defined(CRC_CR_POLYSIZE)
+    uint32_t _CR = CRC_CR_RESET;
+
+    if(hdev->Width == 8)
+    {
+        _CR |= CRC_CR_POLYSIZE_1;
+    }
+    else if(hdev->Width == 16)
+    {
+        _CR |= CRC_CR_POLYSIZE_0;
+    };
+
+    if(hdev->refIn)
+    {
+        _CR |= CRC_CR_REV_IN_0;
+    };
+
+    hdev->Instance->POL = hdev->Poly;
+    hdev->Instance->INIT = hdev->Init;
+    hdev->Instance->CR = _CR;
+#else
+    (void)hdev;
+#endif
+};
+
+
+/**
+ * @brief Computes the current configuration in software
+ * @param hdev Pointer to CRC peripheral context
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Final CRC value
+ */
+static uint32_t errCrcHw_Software(herrCrcHw_T *hdev, uint8_t *_data, size_t _dataLength)
+{
+    if(hdev->Width == 8)
+    {
+        hcrc8_T _crc8 = {(uint8_t)hdev->Poly, (uint8_t)hdev->Init, hdev->refIn, hdev->refOut, (uint8_t)hdev->xorOut};
+        return CRC8_CalcLarge(&_crc8, _data, _dataLength);
+    }
+    else if(hdev->Width == 16)
+    {
+        hcrc16_T _crc16 = {(uint16_t)hdev->Poly, (uint16_t)hdev->Init, hdev->refIn, hdev->refOut, (uint16_t)hdev->xorOut};
+        return CRC16_CalcLarge(&_crc16, _data, _dataLength);
+    }
+    else
+    {
+        hcrc32_T _crc32 = {hdev->Poly, hdev->Init, hdev->refIn, hdev->refOut, hdev->xorOut};
+        return CRC32_CalcLarge(&_crc32, _data, _dataLength);
+    };
+};
+
+
+/**
+ * @brief Reads the peripheral register and applies xorOut and refOut
+ * @param hdev Pointer to CRC peripheral context
+ * @return uint32_t Final CRC value
+ */
+static uint32_t errCrcHw_Result(herrCrcHw_T *hdev)
+{
+    uint32_t _CRC = hdev->Instance->DR;
+
+    if(hdev->Width < 32)
+    {
+        _CRC &= (1UL << hdev->Width) - 1UL;
+    };
+
+    _CRC ^= hdev->xorOut;
+
+    if(hdev->refOut)
+    {
+        _CRC = bitReflected(_CRC, hdev->Width);
+    };
+
+    return _CRC;
+};
+
+
+/**
+ * @brief Starts the next DMA transfer of the running calculation
+ * @param hdev Pointer to CRC peripheral context
+ * @return bool true when the transfer was started
+ */
+static bool errCrcHw_NextChunk(herrCrcHw_T *hdev)
+{
+    uint32_t _length = (hdev->Remaining > ERR_STM32_DMA_MAX) ? ERR_STM32_DMA_MAX : (uint32_t)hdev->Remaining;
+    uint8_t *_chunk = hdev->Next;
+
+    hdev->Next += _length;
+    hdev->Remaining -= _length;
+
+    return HAL_DMA_Start_IT(hdev->hdma, (uint32_t)_chunk, (uint32_t)&hdev->Instance->DR, _length) == HAL_OK;
+};
+
+
+/**
+ * @brief Ends the running calculation and calls the completion callback
+ * @param hdev Pointer to CRC peripheral context
+ * @param _CRC Final CRC value
+ */
+static void errCrcHw_Finish(herrCrcHw_T *hdev, uint32_t _CRC)
+{
+    errCrcHwCallback_T _callback = hdev->Callback;
+
+    hdev->Busy = false;
+
+    if(_callback != NULL)
+    {
+        _callback(hdev->Arg, _CRC);
+    };
+};
+
+
+/**
+ * @brief DMA transfer complete callback
+ * @param hdma DMA handle linked by errCrcHw_Init
+ */
+static void errCrcHw_DmaCplt(DMA_HandleTypeDef *hdma)
+{
+    herrCrcHw_T *hdev = (herrCrcHw_T *)hdma->Parent;
+
+    if(hdev->Remaining > 0)
+    {
+        if(errCrcHw_NextChunk(hdev))
+        {
+            return;
+        };
+
+        errCrcHw_Finish(hdev, errCrcHw_Software(hdev, hdev->Data, hdev->Length));
+        return;
+    };
+
+    errCrcHw_Finish(hdev, errCrcHw_Result(hdev));
+};
+
+
+/**
+ * @brief DMA transfer error callback
+ * @param hdma DMA handle linked by errCrcHw_Init
+ *
+ * @note The number of bytes that reached the peripheral is unknown after a
+ *       bus error, so the whole buffer is recomputed in software.
+ */
+static void errCrcHw_DmaError(DMA_HandleTypeDef *hdma)
+{
+    herrCrcHw_T *hdev = (herrCrcHw_T *)hdma->Parent;
+
+    errCrcHw_Finish(hdev, errCrcHw_Software(hdev, hdev->Data, hdev->Length));
+};
+
+
+/**
+ * @brief Initializes the CRC peripheral context
+ * @param hdev Pointer to CRC peripheral context
+ * @param hdma Memory-to-memory DMA handle, or NULL for CPU feeding only
+ *
+ * @note Enables the CRC clock and links the DMA handle to the context. The
+ *       DMA channel must already be initialized by the application
+ *       (HAL_DMA_Init) as memory-to-memory, byte data width on both sides,
+ *       source increment, destination fixed, normal mode, with its IRQ
+ *       enabled. The context starts with the CRC32_ISO_HDLC configuration.
+ */
+void errCrcHw_Init(herrCrcHw_T *hdev, DMA_HandleTypeDef *hdma)
+{
+    hcrc32_T _crc32 = CRC32_ISO_HDLC;
+
+    __HAL_RCC_CRC_CLK_ENABLE();
+
+    hdev->Instance = CRC;
+    hdev->hdma = hdma;
+    hdev->Busy = false;
+    hdev->Data = NULL;
+    hdev->Length = 0x00;
+    hdev->Next = NULL;
+    hdev->Remaining = 0x00;
+    hdev->Callback = NULL;
+    hdev->Arg = NULL;
+
+    if(hdma != NULL)
+    {
+        hdma->Parent = hdev;
+        hdma->XferCpltCallback = errCrcHw_DmaCplt;
+        hdma->XferErrorCallback = errCrcHw_DmaError;
+    };
+
+    errCrcHw_Config32(hdev, &_crc32);
+};
+
+
+/**
+ * @brief Selects a CRC8 configuration
+ * @param hdev Pointer to CRC peripheral context
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @return bool true when the peripheral computes it, false when software is used
+ */
+bool errCrcHw_Config8(herrCrcHw_T *hdev, hcrc8_T *hcrc)
+{
+    return errCrcHw_Config(hdev, 8, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut);
+};
+
+
+/**
+ * @brief Selects a CRC16 configuration
+ * @param hdev Pointer to CRC peripheral context
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @return bool true when the peripheral computes it, false when software is used
+ */
+bool errCrcHw_Config16(herrCrcHw_T *hdev, hcrc16_T *hcrc)
+{
+    return errCrcHw_Config(hdev, 16, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut);
+};
+
+
+/**
+ * @brief Selects a CRC32 configuration
+ * @param hdev Pointer to CRC peripheral context
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @return bool true when the peripheral computes it, false when software is used
+ */
+bool errCrcHw_Config32(herrCrcHw_T *hdev, hcrc32_T *hcrc)
+{
+    return errCrcHw_Config(hdev, 32, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut);
+};
+
+
+/**
+ * @brief Calculates the CRC of a buffer, feeding the peripheral from the CPU
+ * @param hdev Pointer to CRC peripheral context
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Final CRC value (same as CRCxx_Calc with the selected configuration)
+ *
+ * @note Aligned words are written to DR 32 bits at a time after a byte swap
+ *       (__REV), so the unit still sees the bytes in memory order; the head
+ *       and tail go through 8-bit writes. CR, POL and INIT are reloaded from
+ *       the context first. Must not be called while a DMA calculation started
+ *       by errCrcHw_Start is running.
+ */
+uint32_t errCrcHw_Calc(herrCrcHw_T *hdev, uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _word = 0x00;
+
+    if(!hdev->Hardware)
+    {
+        return errCrcHw_Software(hdev, _data, _dataLength);
+    };
+
+    errCrcHw_Program(hdev);
+
+    while((_dataLength > 0) && (((uintptr_t)_data & 0x03) != 0))
+    {
+        *(__IO uint8_t *)&hdev->Instance->DR = *_data++;
+        _dataLength--;
+    };
+
+    while(_dataLength >= 4)
+    {
+        memcpy(&_word, _data, 4);
+        hdev->Instance->DR = __REV(_word);
+        _data += 4;
+        _dataLength -= 4;
+    };
+
+    while(_dataLength > 0)
+    {
+        *(__IO uint8_t *)&hdev->Instance->DR = *_data++;
+        _dataLength--;
+    };
+
+    return errCrcHw_Result(hdev);
+};
+
+
+/**
+ * @brief Starts a CRC calculation fed by DMA
+ * @param hdev Pointer to CRC peripheral context
+ * @param _data Pointer to input data array (must stay valid until the callback)
+ * @param _dataLength Length of data in bytes
+ * @param _callback Function called with the final CRC when the calculation ends
+ * @param _arg Argument passed to the callback
+ * @return bool true when started, false when a calculation is already running
+ *
+ * @note The callback runs from the DMA interrupt. Buffers longer than 65535
+ *       bytes are sent in several transfers chained from that interrupt.
+ *       Empty buffers, contexts without a DMA handle and configurations the
+ *       peripheral cannot compute finish synchronously: the callback is
+ *       called before this function returns. On parts with a data cache
+ *       (F7, H7) the buffer must be cleaned from the cache before the call.
+ */
+bool errCrcHw_Start(herrCrcHw_T *hdev, uint8_t *_data, size_t _dataLength, errCrcHwCallback_T _callback, void *_arg)
+{
+    if(hdev->Busy)
+    {
+        return false;
+    };
+
+    hdev->Busy = true;
+    hdev->Callback = _callback;
+    hdev->Arg = _arg;
+    hdev->Data = _data;
+    hdev->Length = _dataLength;
+
+    if(!hdev->Hardware || (hdev->hdma == NULL) || (_dataLength == 0))
+    {
+        errCrcHw_Finish(hdev, errCrcHw_Calc(hdev, _data, _dataLength));
+        return true;
+    };
+
+    errCrcHw_Program(hdev);
+    hdev->Next = _data;
+    hdev->Remaining = _dataLength;
+
+    if(!errCrcHw_NextChunk(hdev))
+    {
+        errCrcHw_Finish(hdev, errCrcHw_Calc(hdev, _data, _dataLength));
+    };
+
+    return true;
+};
+
+#endif /* CRC && HAL_DMA_MODULE_ENABLED */
\ No newline at end of file
@@ -0,0 +1,121 @@
+/**
+ * @file     err_stm32.h
+ * @brief    Error Detection Library - STM32 CRC peripheral backend
+ * @note     Computes CRC8/CRC16/CRC32 on the STM32 CRC unit, fed by the CPU or
+ *           by a memory-to-memory DMA channel with a completion callback.
+ *           Programmable polynomials need a CRC unit with POLYSIZE support
+ *           (F0x1/F0x2/F0x8, F3, F7, G0, G4, H7, L0, L4, L5, WB, ...); other
+ *           configurations and parts fall back to the software engines.
+ *           Requires the STM32 HAL (DMA module) to be included by aKaReZa.h.
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     For detailed explanations, usage examples, and implementation notes,
+ *           please visit the repository:
+ *           https://github.com/aKaReZa75/Error_Detection
+ */
+
+#ifndef _err_stm32_H_
+#define _err_stm32_H_
+
+#include "err.h"
+
+#if defined(CRC) && defined(HAL_DMA_MODULE_ENABLED)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Completion callback of an asynchronous CRC calculation
+ * @param _arg User argument passed to errCrcHw_Start
+ * @param _CRC Final CRC value (xorOut and refOut applied)
+ */
+typedef void (*errCrcHwCallback_T)(void *_arg, uint32_t _CRC);
+
+/**
+ * @brief STM32 CRC peripheral context
+ */
+typedef struct
+{
+  CRC_TypeDef *Instance;            ///< CRC peripheral registers
+  DMA_HandleTypeDef *hdma;          ///< Memory-to-memory DMA handle, or NULL for CPU feeding only
+  uint8_t Width;                    ///< CRC width of the current configuration (8, 16 or 32)
+  uint32_t Poly;                    ///< Polynomial of the current configuration
+  uint32_t Init;                    ///< Initial value of the current configuration
+  bool refIn;                       ///< Input reflection of the current configuration
+  bool refOut;                      ///< Output reflection of the current configuration
+  uint32_t xorOut;                  ///< Final XOR value of the current configuration
+  bool Hardware;                    ///< true when the peripheral can compute the configuration
+  volatile bool Busy;               ///< true while a DMA calculation is running
+  uint8_t *Data;                    ///< Buffer of the running calculation
+  size_t Length;                    ///< Length of the running calculation
+  uint8_t *Next;                   ///< Next byte to be transferred by DMA
+  size_t Remaining;                 ///< Bytes still to be transferred by DMA
+  errCrcHwCallback_T Callback;      ///< Completion callback of the running calculation
+  void *Arg;                        ///< Argument of the completion callback
+} herrCrcHw_T;
+
+/**
+ * @brief Initialize the CRC peripheral context
+ * @param hdev Pointer to CRC peripheral context
+ * @param hdma Memory-to-memory DMA handle (byte data width, source increment,
+ *             destination fixed, normal mode), or NULL for CPU feeding only
+ */
+void errCrcHw_Init(herrCrcHw_T *hdev, DMA_HandleTypeDef *hdma);
+
+/**
+ * @brief Select a CRC8 configuration
+ * @param hdev Pointer to CRC peripheral context
+ * @param hcrc Pointer to CRC8 configuration structure
+ * @return bool true when the peripheral computes it, false when software is used
+ *         or a DMA calculation is running (the configuration is then unchanged)
+ */
+bool errCrcHw_Config8(herrCrcHw_T *hdev, hcrc8_T *hcrc);
+
+/**
+ * @brief Select a CRC16 configuration
+ * @param hdev Pointer to CRC peripheral context
+ * @param hcrc Pointer to CRC16 configuration structure
+ * @return bool true when the peripheral computes it, false when software is used
+ *         or a DMA calculation is running (the configuration is then unchanged)
+ */
+bool errCrcHw_Config16(herrCrcHw_T *hdev, hcrc16_T *hcrc);
+
+/**
+ * @brief Select a CRC32 configuration
+ * @param hdev Pointer to CRC peripheral context
+ * @param hcrc Pointer to CRC32 configuration structure
+ * @return bool true when the peripheral computes it, false when software is used
+ *         or a DMA calculation is running (the configuration is then unchanged)
+ */
+bool errCrcHw_Config32(herrCrcHw_T *hdev, hcrc32_T *hcrc);
+
+/**
+ * @brief Calculate the CRC of a buffer, feeding the peripheral from the CPU
+ * @param hdev Pointer to CRC peripheral context
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint32_t Final CRC value (same as CRCxx_Calc with the selected configuration)
+ */
+uint32_t errCrcHw_Calc(herrCrcHw_T *hdev, uint8_t *_data, size_t _dataLength);
+
+/**
+ * @brief Start a CRC calculation fed by DMA
+ * @param hdev Pointer to CRC peripheral context
+ * @param _data Pointer to input data array (must stay valid until the callback)
+ * @param _dataLength Length of data in bytes
+ * @param _callback Function called with the final CRC when the calculation ends
+ * @param _arg Argument passed to the callback
+ * @return bool true when started, false when a calculation is already running
+ */
+bool errCrcHw_Start(herrCrcHw_T *hdev, uint8_t *_data, size_t _dataLength, errCrcHwCallback_T _callback, void *_arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC && HAL_DMA_MODULE_ENABLED */
+
+#endif
\ No newline at end of file
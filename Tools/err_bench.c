@@ -0,0 +1,677 @@
+/**
+ * @file     err_bench.c
+ * @brief    Error Detection Library - throughput benchmark
+ * @note     Times every checksum and CRC kernel (bitwise, table, nibble, slicing,
+ *           preset / hardware paths) for every preset of CRC_Reference.md
+ *           over a sweep of buffer sizes and alignments, and prints GB/s and
+ *           cycles/byte.
+ *
+ *           Host build (Linux/macOS, aKaReZa.h on the include path):
+ *
+ *               cc -O2 -I../Sources -I<aKaReZa.h dir> -o err_bench err_bench.c ../Sources/err.c
+ *               ./err_bench [-s max_bytes] [-t seconds] [-g GHz] [-k filter] [-d kernel]
+ *
+ *           Cycles are read from the TSC on x86-64; on other hosts pass the
+ *           core clock with -g to get cycles/byte. -d pins the kernel behind
+ *           CRCxx_CalcLarge and checkSumXX_CalcLarge (err_KernelSet, by the
+ *           name err_KernelName prints: bitwise, table, clmul, hw, simd, ...)
+ *           for every family that has it, to A/B test kernels. The "calc"
+ *           rows run that selection, the "bitwise" rows always pin the
+ *           bitwise engine.
+ *
+ *           Cortex-M build: compile with -DERR_BENCH_DWT=1 together with the
+ *           application and call errBench_Main() after the clock setup. The
+ *           DWT cycle counter (DWT_CYCCNT) times every run, SystemCoreClock
+ *           converts cycles to GB/s and printf must be retargeted to a UART
+ *           or SWO. Buffers go up to ERR_BENCH_BUFFER bytes (default 16 KB).
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     For detailed explanations, usage examples, and implementation notes,
+ *           please visit the repository:
+ *           https://github.com/aKaReZa75/Error_Detection
+ */
+#ifndef ERR_BENCH_DWT
+  #define ERR_BENCH_DWT 0
+#endif
+
+#if !ERR_BENCH_DWT && !defined(_POSIX_C_SOURCE)
+  #define _POSIX_C_SOURCE 199309L   ///< clock_gettime with -std=c99
+#endif
+
+#include "err.h"
+#include <stdio.h>
+#include <string.h>
+
+#if !ERR_BENCH_DWT
+  #include <stdlib.h>
+  #include <time.h>
+  #if defined(__x86_64__)
+    #include <x86intrin.h>
+  #endif
+#endif
+
+/**
+ * @brief Largest buffer of the sweep (64 MB on hosts, 16 KB on target)
+ */
+#ifndef ERR_BENCH_BUFFER
+  #if ERR_BENCH_DWT
+    #define ERR_BENCH_BUFFER (16UL * 1024UL)
+  #else
+    #define ERR_BENCH_BUFFER (64UL * 1024UL * 1024UL)
+  #endif
+#endif
+
+#define ERR_BENCH_ALIGNMENTS 2   ///< Buffer offsets of the sweep: 0 and 1 byte
+
+
+/**
+ * @brief Benchmark kernel: one algorithm with one configuration
+ */
+typedef struct
+{
+  const char *Name;                             ///< Kernel name printed in the report
+  uint32_t (*Run)(uint8_t *_data, size_t _dataLength);  ///< Calculation under test
+  errKernel_T Pin;                              ///< Kernel selected for every family while it runs, ERR_KERNEL_AUTO to keep the selection
+} errBenchKernel_T;
+
+
+/**
+ * @brief Configuration, table context and wrappers of one CRC preset
+ * @details Defines <PRESET>_Dispatch (CRCxx_CalcLarge), <PRESET>_Table
+ *          (CRCxx_TableCalc), <PRESET>_NibbleRun (CRCxx_NibbleCalc),
+ *          <PRESET>_Byte (CRCxx_UpdateByte per byte) and,
+ *          with ERR_PRESETS, <PRESET>_Preset
+ *          (<PRESET>_Calc with its ROM table / hardware path).
+ */
+#define ERR_BENCH_CRC(_width, _preset)                                                      \
+    static hcrc##_width##_T _preset##_Config = _preset;                                     \
+    static hcrc##_width##Table_T _preset##_TableCtx;                                        \
+    static hcrc##_width##Nibble_T _preset##_NibbleCtx;                                      \
+    static uint32_t _preset##_Dispatch(uint8_t *_data, size_t _dataLength)                  \
+    {                                                                                       \
+        return CRC##_width##_CalcLarge(&_preset##_Config, _data, _dataLength);              \
+    };                                                                                      \
+    static uint32_t _preset##_Table(uint8_t *_data, size_t _dataLength)                     \
+    {                                                                                       \
+        return CRC##_width##_TableCalc(&_preset##_TableCtx, _data, _dataLength);            \
+    };                                                                                      \
+    static uint32_t _preset##_NibbleRun(uint8_t *_data, size_t _dataLength)                 \
+    {                                                                                       \
+        return CRC##_width##_NibbleCalc(&_preset##_NibbleCtx, _data, _dataLength);          \
+    };                                                                                      \
+    static uint32_t _preset##_Byte(uint8_t *_data, size_t _dataLength)                      \
+    {                                                                                       \
+        hcrc##_width##Ctx_T _ctx;                                                           \
+        CRC##_width##_InitTable(&_ctx, &_preset##_TableCtx);                                \
+        for(; _dataLength > 0; _dataLength--, _data++)                                      \
+        {                                                                                   \
+            CRC##_width##_UpdateByte(&_ctx, *_data);                                        \
+        };                                                                                  \
+        return CRC##_width##_Final(&_ctx);                                                  \
+    };                                                                                      \
+    ERR_BENCH_PRESET_FN(_preset##_Preset, _preset##_Calc)
+
+/* Pasted names are passed on, a bare preset name would expand to its initializer */
+#if ERR_PRESETS
+  #define ERR_BENCH_PRESET_FN(_wrapper, _function)                                          \
+    static uint32_t _wrapper(uint8_t *_data, size_t _dataLength)                            \
+    {                                                                                       \
+        return _function(_data, _dataLength);                                               \
+    };
+  #define ERR_BENCH_PRESET_ROW(_name, _wrapper) { _name, _wrapper, ERR_KERNEL_AUTO },
+#else
+  #define ERR_BENCH_PRESET_FN(_wrapper, _function)
+  #define ERR_BENCH_PRESET_ROW(_name, _wrapper)
+#endif
+
+#define ERR_BENCH_CRC_ROWS(_width, _preset)                                                 \
+    { #_preset " calc", _preset##_Dispatch, ERR_KERNEL_AUTO },                              \
+    { #_preset " bitwise", _preset##_Dispatch, ERR_KERNEL_BITWISE },                        \
+    { #_preset " table", _preset##_Table, ERR_KERNEL_AUTO },                                \
+    { #_preset " nibble", _preset##_NibbleRun, ERR_KERNEL_AUTO },                           \
+    { #_preset " byte", _preset##_Byte, ERR_KERNEL_AUTO },                                  \
+    ERR_BENCH_PRESET_ROW(#_preset "_Calc", _preset##_Preset)
+
+ERR_BENCH_CRC(8, CRC8_MAXIM)
+ERR_BENCH_CRC(8, CRC8_NRSC5)
+ERR_BENCH_CRC(8, CRC8_ATM)
+ERR_BENCH_CRC(8, CRC8_SAE_J1850)
+ERR_BENCH_CRC(16, CRC16_MODBUS)
+ERR_BENCH_CRC(16, CRC16_CCITT_FALSE)
+ERR_BENCH_CRC(32, CRC32_ISO_HDLC)
+ERR_BENCH_CRC(32, CRC32C)
+
+static hcrc32Slice_T CRC32_ISO_HDLC_SliceCtx;
+static hcrc32Slice_T CRC32C_SliceCtx;
+
+static uint32_t CRC32_ISO_HDLC_Slice(uint8_t *_data, size_t _dataLength)
+{
+    return CRC32_SliceCalc(&CRC32_ISO_HDLC_SliceCtx, _data, _dataLength);
+};
+
+static uint32_t CRC32C_Slice(uint8_t *_data, size_t _dataLength)
+{
+    return CRC32_SliceCalc(&CRC32C_SliceCtx, _data, _dataLength);
+};
+
+/**
+ * @brief Configuration, table context and wrappers of one generic CRC preset
+ * @details Defines <PRESET>_Bitwise (CRCN_Calc) and <PRESET>_Table
+ *          (CRCN_TableCalc); results are truncated to 32 bits.
+ */
+#define ERR_BENCH_CRCN(_preset)                                                             \
+    static hcrcN_T _preset##_Config = _preset;                                              \
+    static hcrcNTable_T _preset##_TableCtx;                                                 \
+    static uint32_t _preset##_Bitwise(uint8_t *_data, size_t _dataLength)                   \
+    {                                                                                       \
+        return (uint32_t)CRCN_Calc(&_preset##_Config, _data, _dataLength);                  \
+    };                                                                                      \
+    static uint32_t _preset##_Table(uint8_t *_data, size_t _dataLength)                     \
+    {                                                                                       \
+        return (uint32_t)CRCN_TableCalc(&_preset##_TableCtx, _data, _dataLength);           \
+    };
+
+#define ERR_BENCH_CRCN_ROWS(_preset)                                                        \
+    { #_preset " bitwise", _preset##_Bitwise, ERR_KERNEL_AUTO },                            \
+    { #_preset " table", _preset##_Table, ERR_KERNEL_AUTO },
+
+ERR_BENCH_CRCN(CRC5_USB)
+ERR_BENCH_CRCN(CRC15_CAN)
+ERR_BENCH_CRCN(CRC24_OPENPGP)
+ERR_BENCH_CRCN(CRC64_ECMA_182)
+ERR_BENCH_CRCN(CRC64_XZ)
+
+/**
+ * @brief Runs CRC16_MultiUpdate over _lanes equal slices of the buffer
+ * @return uint32_t XOR of the lane CRCs, 0 when ERR_MULTI_LANES is smaller than _lanes
+ */
+static uint32_t errBench_Multi16(uint8_t _lanes, uint8_t *_data, size_t _dataLength)
+{
+    hcrc16Multi_T _ctx;
+    errBuffer_T _fragments[ERR_MULTI_LANES];
+    uint32_t _CRC = 0x00;
+    uint8_t _lane = 0x00;
+
+    if(!CRC16_MultiInit(&_ctx, &CRC16_MODBUS_TableCtx, NULL, _lanes))
+    {
+        return 0;
+    };
+    for(_lane = 0; _lane < _lanes; _lane++)
+    {
+        _fragments[_lane].Data = _data + _lane * (_dataLength / _lanes);
+        _fragments[_lane].Length = _dataLength / _lanes;
+    };
+    CRC16_MultiUpdate(&_ctx, _fragments);
+    for(_lane = 0; _lane < _lanes; _lane++)
+    {
+        _CRC ^= CRC16_MultiFinal(&_ctx, _lane);
+    };
+
+    return _CRC;
+};
+
+static uint32_t CRC16_MODBUS_Multi4(uint8_t *_data, size_t _dataLength)
+{
+    return errBench_Multi16(4, _data, _dataLength);
+};
+
+static uint32_t CRC16_MODBUS_Multi8(uint8_t *_data, size_t _dataLength)
+{
+    return errBench_Multi16(8, _data, _dataLength);
+};
+
+static uint32_t errBench_Sum8(uint8_t *_data, size_t _dataLength)
+{
+    return checkSum8_CalcLarge(_data, _dataLength);
+};
+
+static uint32_t errBench_Sum16(uint8_t *_data, size_t _dataLength)
+{
+    return checkSum16_CalcLarge(_data, _dataLength);
+};
+
+static uint32_t errBench_Sum32(uint8_t *_data, size_t _dataLength)
+{
+    return checkSum32_CalcLarge(_data, _dataLength);
+};
+
+static uint32_t errBench_Fletcher16(uint8_t *_data, size_t _dataLength)
+{
+    return Fletcher16_Calc(_data, _dataLength);
+};
+
+static uint32_t errBench_Fletcher32(uint8_t *_data, size_t _dataLength)
+{
+    return Fletcher32_Calc(_data, _dataLength);
+};
+
+static uint32_t errBench_Adler32(uint8_t *_data, size_t _dataLength)
+{
+    return Adler32_Calc(_data, _dataLength);
+};
+
+static uint32_t errBench_Inet(uint8_t *_data, size_t _dataLength)
+{
+    return checkSumInet_Calc(_data, _dataLength);
+};
+
+
+static const errBenchKernel_T errBench_Kernels[] =
+{
+    { "checkSum8", errBench_Sum8, ERR_KERNEL_AUTO },
+    { "checkSum16", errBench_Sum16, ERR_KERNEL_AUTO },
+    { "checkSum32", errBench_Sum32, ERR_KERNEL_AUTO },
+    { "Fletcher16", errBench_Fletcher16, ERR_KERNEL_AUTO },
+    { "Fletcher32", errBench_Fletcher32, ERR_KERNEL_AUTO },
+    { "Adler32", errBench_Adler32, ERR_KERNEL_AUTO },
+    { "checkSumInet", errBench_Inet, ERR_KERNEL_AUTO },
+    ERR_BENCH_CRC_ROWS(8, CRC8_MAXIM)
+    ERR_BENCH_CRC_ROWS(8, CRC8_NRSC5)
+    ERR_BENCH_CRC_ROWS(8, CRC8_ATM)
+    ERR_BENCH_CRC_ROWS(8, CRC8_SAE_J1850)
+    ERR_BENCH_CRC_ROWS(16, CRC16_MODBUS)
+    { "CRC16_MODBUS multi4", CRC16_MODBUS_Multi4, ERR_KERNEL_AUTO },
+    { "CRC16_MODBUS multi8", CRC16_MODBUS_Multi8, ERR_KERNEL_AUTO },
+    ERR_BENCH_CRC_ROWS(16, CRC16_CCITT_FALSE)
+    ERR_BENCH_CRC_ROWS(32, CRC32_ISO_HDLC)
+    { "CRC32_ISO_HDLC slice", CRC32_ISO_HDLC_Slice, ERR_KERNEL_AUTO },
+    ERR_BENCH_CRC_ROWS(32, CRC32C)
+    { "CRC32C slice", CRC32C_Slice, ERR_KERNEL_AUTO },
+    ERR_BENCH_CRCN_ROWS(CRC5_USB)
+    ERR_BENCH_CRCN_ROWS(CRC15_CAN)
+    ERR_BENCH_CRCN_ROWS(CRC24_OPENPGP)
+    ERR_BENCH_CRCN_ROWS(CRC64_ECMA_182)
+    ERR_BENCH_CRCN_ROWS(CRC64_XZ)
+};
+
+
+#if ERR_BENCH_DWT
+static uint8_t errBench_Buffer[ERR_BENCH_BUFFER + ERR_BENCH_ALIGNMENTS];
+#else
+static uint8_t *errBench_Buffer = NULL;
+#endif
+
+static volatile uint32_t errBench_Sink;   ///< Keeps the results alive
+
+
+/**
+ * @brief Builds the table contexts and fills the buffer with random bytes
+ * @param _bufferLength Bytes of the buffer to fill
+ */
+static void errBench_Setup(size_t _bufferLength)
+{
+    uint32_t _state = 0x2545F491UL;
+    size_t _index = 0x00;
+
+    CRC8_TableInit(&CRC8_MAXIM_TableCtx, &CRC8_MAXIM_Config);
+    CRC8_NibbleInit(&CRC8_MAXIM_NibbleCtx, &CRC8_MAXIM_Config);
+    CRC8_TableInit(&CRC8_NRSC5_TableCtx, &CRC8_NRSC5_Config);
+    CRC8_NibbleInit(&CRC8_NRSC5_NibbleCtx, &CRC8_NRSC5_Config);
+    CRC8_TableInit(&CRC8_ATM_TableCtx, &CRC8_ATM_Config);
+    CRC8_NibbleInit(&CRC8_ATM_NibbleCtx, &CRC8_ATM_Config);
+    CRC8_TableInit(&CRC8_SAE_J1850_TableCtx, &CRC8_SAE_J1850_Config);
+    CRC8_NibbleInit(&CRC8_SAE_J1850_NibbleCtx, &CRC8_SAE_J1850_Config);
+    CRC16_TableInit(&CRC16_MODBUS_TableCtx, &CRC16_MODBUS_Config);
+    CRC16_NibbleInit(&CRC16_MODBUS_NibbleCtx, &CRC16_MODBUS_Config);
+    CRC16_TableInit(&CRC16_CCITT_FALSE_TableCtx, &CRC16_CCITT_FALSE_Config);
+    CRC16_NibbleInit(&CRC16_CCITT_FALSE_NibbleCtx, &CRC16_CCITT_FALSE_Config);
+    CRC32_TableInit(&CRC32_ISO_HDLC_TableCtx, &CRC32_ISO_HDLC_Config);
+    CRC32_NibbleInit(&CRC32_ISO_HDLC_NibbleCtx, &CRC32_ISO_HDLC_Config);
+    CRC32_TableInit(&CRC32C_TableCtx, &CRC32C_Config);
+    CRC32_NibbleInit(&CRC32C_NibbleCtx, &CRC32C_Config);
+    CRC32_SliceInit(&CRC32_ISO_HDLC_SliceCtx, &CRC32_ISO_HDLC_Config);
+    CRC32_SliceInit(&CRC32C_SliceCtx, &CRC32C_Config);
+    CRCN_TableInit(&CRC5_USB_TableCtx, &CRC5_USB_Config);
+    CRCN_TableInit(&CRC15_CAN_TableCtx, &CRC15_CAN_Config);
+    CRCN_TableInit(&CRC24_OPENPGP_TableCtx, &CRC24_OPENPGP_Config);
+    CRCN_TableInit(&CRC64_ECMA_182_TableCtx, &CRC64_ECMA_182_Config);
+    CRCN_TableInit(&CRC64_XZ_TableCtx, &CRC64_XZ_Config);
+
+    for(_index = 0; _index < _bufferLength; _index++)
+    {
+        _state ^= _state << 13;
+        _state ^= _state >> 17;
+        _state ^= _state << 5;
+        errBench_Buffer[_index] = (uint8_t)_state;
+    };
+};
+
+
+#if ERR_BENCH_DWT
+
+/**
+ * @brief Starts the DWT cycle counter
+ */
+static void errBench_TimerInit(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+};
+
+/**
+ * @brief Reads the cycle counter
+ * @return uint64_t Core cycles (32-bit counter, differences stay valid across one wrap)
+ */
+static uint64_t errBench_Cycles(void)
+{
+    return DWT->CYCCNT;
+};
+
+#else
+
+static double errBench_Ghz = 0.0;   ///< Core clock given with -g, 0 = unknown
+
+/**
+ * @brief Reads the monotonic clock
+ * @return double Seconds
+ */
+static double errBench_Seconds(void)
+{
+    struct timespec _time;
+
+    clock_gettime(CLOCK_MONOTONIC, &_time);
+    return (double)_time.tv_sec + ((double)_time.tv_nsec * 1e-9);
+};
+
+/**
+ * @brief Reads the cycle counter
+ * @return uint64_t TSC cycles on x86-64, 0 elsewhere
+ */
+static uint64_t errBench_Cycles(void)
+{
+  #if defined(__x86_64__)
+    return __rdtsc();
+  #else
+    return 0;
+  #endif
+};
+
+#endif
+
+
+/**
+ * @brief Times one kernel at one size and alignment and prints a report line
+ * @param _kernel Kernel under test
+ * @param _dataLength Buffer length in bytes
+ * @param _align Buffer offset in bytes
+ * @param _seconds Minimum measuring time
+ * 
+ * @note A pinned kernel is selected for every family that has it and the
+ *       previous selection is restored afterwards.
+ */
+static void errBench_Measure(const errBenchKernel_T *_kernel, size_t _dataLength, uint8_t _align, double _seconds)
+{
+    errKernel_T _saved[ERR_DISPATCH_COUNT];
+    uint8_t _family = 0x00;
+    uint8_t *_data = errBench_Buffer + _align;
+    uint32_t _iterations = 1;
+    uint32_t _index = 0x00;
+    uint32_t _result = 0x00;
+    uint64_t _cycles = 0x00;
+    double _elapsed = 0.0;
+    double _bytes = 0.0;
+    double _cyclesPerByte = 0.0;
+#if ERR_BENCH_DWT
+    uint32_t _start = 0x00;
+#else
+    double _start = 0.0;
+#endif
+
+    for(_family = 0; (_family < ERR_DISPATCH_COUNT) && (_kernel->Pin != ERR_KERNEL_AUTO); _family++)
+    {
+        _saved[_family] = err_KernelGet((errDispatch_T)_family);
+        (void)err_KernelSet((errDispatch_T)_family, _kernel->Pin);
+    };
+
+    while(1)
+    {
+#if ERR_BENCH_DWT
+        _start = (uint32_t)errBench_Cycles();
+        for(_index = 0; _index < _iterations; _index++)
+        {
+            _result ^= _kernel->Run(_data, _dataLength);
+        };
+        _cycles = (uint32_t)((uint32_t)errBench_Cycles() - _start);
+        _elapsed = (double)_cycles / (double)SystemCoreClock;
+#else
+        uint64_t _startCycles = errBench_Cycles();
+
+        _start = errBench_Seconds();
+        for(_index = 0; _index < _iterations; _index++)
+        {
+            _result ^= _kernel->Run(_data, _dataLength);
+        };
+        _elapsed = errBench_Seconds() - _start;
+        _cycles = errBench_Cycles() - _startCycles;
+#endif
+
+        if((_elapsed >= _seconds) || (_iterations >= 0x40000000UL))
+        {
+            break;
+        };
+
+        _iterations <<= 1;
+    };
+
+    for(_family = 0; (_family < ERR_DISPATCH_COUNT) && (_kernel->Pin != ERR_KERNEL_AUTO); _family++)
+    {
+        (void)err_KernelSet((errDispatch_T)_family, _saved[_family]);
+    };
+
+    errBench_Sink ^= _result;
+    _bytes = (double)_dataLength * (double)_iterations;
+
+#if !ERR_BENCH_DWT
+    if(errBench_Ghz > 0.0)
+    {
+        _cycles = (uint64_t)(_elapsed * errBench_Ghz * 1e9);
+    };
+#endif
+
+    _cyclesPerByte = (double)_cycles / _bytes;
+
+    if(_cycles != 0)
+    {
+        printf("%-28s %10lu %5u %9.3f %9.3f\n", _kernel->Name, (unsigned long)_dataLength, _align, _bytes / _elapsed / 1e9, _cyclesPerByte);
+    }
+    else
+    {
+        printf("%-28s %10lu %5u %9.3f %9s\n", _kernel->Name, (unsigned long)_dataLength, _align, _bytes / _elapsed / 1e9, "-");
+    };
+};
+
+
+/**
+ * @brief Runs the whole sweep: every kernel, sizes 8 B .. _maxLength in x8 steps
+ *        plus _maxLength itself, offsets 0 and 1
+ * @param _maxLength Largest buffer length in bytes
+ * @param _seconds Minimum measuring time per line
+ * @param _filter Only kernels whose name contains this text, or NULL for all
+ */
+static void errBench_Run(size_t _maxLength, double _seconds, const char *_filter)
+{
+    size_t _kernel = 0x00;
+    size_t _length = 0x00;
+    uint8_t _align = 0x00;
+
+    printf("%-28s %10s %5s %9s %9s\n", "kernel", "bytes", "align", "GB/s", "cyc/B");
+
+    for(_kernel = 0; _kernel < (sizeof(errBench_Kernels) / sizeof(errBench_Kernels[0])); _kernel++)
+    {
+        if((_filter != NULL) && (strstr(errBench_Kernels[_kernel].Name, _filter) == NULL))
+        {
+            continue;
+        };
+
+        for(_length = 8; ; _length <<= 3)
+        {
+            if(_length > _maxLength)
+            {
+                _length = _maxLength;
+            };
+
+            for(_align = 0; _align < ERR_BENCH_ALIGNMENTS; _align++)
+            {
+                errBench_Measure(&errBench_Kernels[_kernel], _length, _align, _seconds);
+            };
+
+            if(_length == _maxLength)
+            {
+                break;
+            };
+        };
+    };
+};
+
+
+#if ERR_BENCH_DWT
+
+/**
+ * @brief Runs the benchmark on target
+ * @note Call after the clock configuration; output goes through printf.
+ */
+void errBench_Main(void)
+{
+    errBench_TimerInit();
+    errBench_Setup(sizeof(errBench_Buffer));
+    printf("core clock %lu Hz\n", (unsigned long)SystemCoreClock);
+    errBench_Run(ERR_BENCH_BUFFER, 0.01, NULL);
+};
+
+#else
+
+/**
+ * @brief Selects a kernel by name for every function family that has it
+ * @param _name Kernel name as printed by err_KernelName
+ * @return bool true when at least one family accepted the kernel
+ */
+static bool errBench_Dispatch(const char *_name)
+{
+    bool _selected = false;
+    uint8_t _kernel = 0x00;
+    uint8_t _family = 0x00;
+
+    for(_kernel = ERR_KERNEL_AUTO; _kernel < ERR_KERNEL_COUNT; _kernel++)
+    {
+        if(strcmp(err_KernelName((errKernel_T)_kernel), _name) != 0)
+        {
+            continue;
+        };
+
+        for(_family = 0; _family < ERR_DISPATCH_COUNT; _family++)
+        {
+            _selected |= err_KernelSet((errDispatch_T)_family, (errKernel_T)_kernel);
+        };
+    };
+
+    return _selected;
+};
+
+
+/**
+ * @brief Parses a whole command line argument as a number
+ * @param _text Argument text
+ * @param _value Receives the number
+ * @return bool true when _text is a non-empty number without trailing characters
+ */
+static bool errBench_Number(const char *_text, double *_value)
+{
+    char *_end = NULL;
+
+    *_value = strtod(_text, &_end);
+
+    return (_end != _text) && (*_end == '\0');
+};
+
+
+/**
+ * @brief Parses a whole command line argument as a buffer size
+ * @param _text Argument text (decimal, 0x hex or 0 octal)
+ * @param _value Receives the size
+ * @return bool true when _text is a size of at least 8 bytes without trailing characters
+ */
+static bool errBench_Size(const char *_text, size_t *_value)
+{
+    char *_end = NULL;
+    unsigned long _size = 0x00;
+
+    if(strchr(_text, '-') != NULL)
+    {
+        return false;
+    };
+
+    _size = strtoul(_text, &_end, 0);
+    *_value = (size_t)_size;
+
+    return (_end != _text) && (*_end == '\0') && (_size >= 8) && (_size <= (unsigned long)(SIZE_MAX - ERR_BENCH_ALIGNMENTS));
+};
+
+
+int main(int argc, char **argv)
+{
+    size_t _maxLength = ERR_BENCH_BUFFER;
+    double _seconds = 0.05;
+    const char *_filter = NULL;
+    bool _valid = true;
+    int _index = 0x00;
+
+    for(_index = 1; (_index < argc) && _valid; _index++)
+    {
+        if((strcmp(argv[_index], "-s") == 0) && (_index + 1 < argc))
+        {
+            _valid = errBench_Size(argv[++_index], &_maxLength);
+        }
+        else if((strcmp(argv[_index], "-t") == 0) && (_index + 1 < argc))
+        {
+            _valid = errBench_Number(argv[++_index], &_seconds) && (_seconds > 0.0);
+        }
+        else if((strcmp(argv[_index], "-g") == 0) && (_index + 1 < argc))
+        {
+            _valid = errBench_Number(argv[++_index], &errBench_Ghz) && (errBench_Ghz > 0.0);
+        }
+        else if((strcmp(argv[_index], "-k") == 0) && (_index + 1 < argc))
+        {
+            _filter = argv[++_index];
+        }
+        else if((strcmp(argv[_index], "-d") == 0) && (_index + 1 < argc))
+        {
+            if(!errBench_Dispatch(argv[++_index]))
+            {
+                fprintf(stderr, "%s: kernel %s is not available\n", argv[0], argv[_index]);
+                return EXIT_FAILURE;
+            };
+        }
+        else
+        {
+            _valid = false;
+        };
+    };
+
+    if(!_valid)
+    {
+        fprintf(stderr, "usage: %s [-s max_bytes (>= 8)] [-t seconds] [-g GHz] [-k filter] [-d kernel]\n", argv[0]);
+        return EXIT_FAILURE;
+    };
+
+    printf("dispatch crc8=%s crc16=%s crc32=%s sum=%s\n", err_KernelName(err_KernelGet(ERR_DISPATCH_CRC8)),
+           err_KernelName(err_KernelGet(ERR_DISPATCH_CRC16)), err_KernelName(err_KernelGet(ERR_DISPATCH_CRC32)),
+           err_KernelName(err_KernelGet(ERR_DISPATCH_SUM)));
+
+    errBench_Buffer = (uint8_t *)malloc(_maxLength + ERR_BENCH_ALIGNMENTS);
+    if(errBench_Buffer == NULL)
+    {
+        fprintf(stderr, "%s: cannot allocate %lu bytes\n", argv[0], (unsigned long)_maxLength);
+        return EXIT_FAILURE;
+    };
+
+    errBench_Setup(_maxLength + ERR_BENCH_ALIGNMENTS);
+    errBench_Run(_maxLength, _seconds, _filter);
+
+    free(errBench_Buffer);
+    return EXIT_SUCCESS;
+};
+
+#endif
\ No newline at end of file
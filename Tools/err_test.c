@@ -0,0 +1,1279 @@
+/**
+ * @file     err_test.c
+ * @brief    Error Detection Library - differential test
+ * @note     Cross-checks every checksum and CRC backend against a plain
+ *           bitwise reference on random buffers and configurations, and
+ *           exits non-zero when any check fails:
+ *
+ *               err_test [seed [iterations]]
+ *
+ *           Build it with the same ERR_xxx switches as the library, so the
+ *           engines under test are the ones the application gets (Linux/macOS,
+ *           aKaReZa.h on the include path):
+ *
+ *               cc -O2 -I../Sources -I<aKaReZa.h dir> -o err_test err_test.c \
+ *                  ../Sources/err.c ../Sources/err_host.c -lpthread
+ *
+ *           The STM32 peripheral backend (err_stm32.c) needs the target
+ *           hardware and is not covered.
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     For detailed explanations, usage examples, and implementation notes,
+ *           please visit the repository:
+ *           https://github.com/aKaReZa75/Error_Detection
+ */
+#ifndef _DEFAULT_SOURCE
+  #define _DEFAULT_SOURCE   ///< mkstemp with -std=c99 on glibc
+#endif
+
+#include "err_host.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define ERR_TEST_BUFFER 4096   ///< Bytes of the random test buffer
+#define ERR_TEST_FRAMES 6      ///< Frames per batch check
+#define ERR_TEST_PATCH 8       ///< Longest span rewritten by the patch checks
+#define ERR_TEST_FIX 8         ///< Longest payload of the error-correction checks
+
+/**
+ * @brief Prints a failed check
+ * @param _name Name of the check
+ * @param _iteration Round in which it failed
+ */
+static void errTest_Report(const char *_name, uint32_t _iteration)
+{
+    printf("%s failed in round %lu\n", _name, (unsigned long)_iteration);
+};
+
+
+/**
+ * @brief Counts and prints a failed check
+ */
+#define ERR_TEST(_check, _name)                     \
+    do                                              \
+    {                                               \
+        if(!(_check))                               \
+        {                                           \
+            errTest_Report(_name, _iteration);      \
+            _fails++;                               \
+        };                                          \
+    } while(0)
+
+
+/**
+ * @brief Test random generator (xorshift32)
+ * @param _state Generator state, never 0
+ * @return uint32_t Next random value
+ */
+static uint32_t errTest_Random(uint32_t *_state)
+{
+    *_state ^= *_state << 13;
+    *_state ^= *_state >> 17;
+    *_state ^= *_state << 5;
+
+    return *_state;
+};
+
+
+/**
+ * @brief Reference bit reflection, one bit per iteration
+ * @param _data Input value
+ * @param _bits Number of low bits to reflect
+ * @return uint64_t Reflected value
+ */
+static uint64_t errTest_Reflect(uint64_t _data, uint8_t _bits)
+{
+    uint64_t _out = 0x00;
+    uint8_t _index = 0x00;
+
+    for(_index = 0; _index < _bits; _index++)
+    {
+        if(bitCheckHigh(_data, _index))
+        {
+            _out |= 1ULL << (_bits - 1 - _index);
+        };
+    };
+
+    return _out;
+};
+
+
+/**
+ * @brief Reference CRC: the original bitwise algorithm of CRC8/16/32_Calc
+ * @param _width CRC width (3..64)
+ * @param _Poly Polynomial
+ * @param _Init Initial value
+ * @param _refIn Input reflection
+ * @param _refOut Output reflection
+ * @param _xorOut Final XOR value
+ * @param _data Pointer to input data array
+ * @param _dataLength Length of data in bytes
+ * @return uint64_t CRC value
+ * 
+ * @note Every input byte is reflected when refIn is set, the register
+ *       shifts MSB first one message bit at a time, and xorOut is applied
+ *       before the output reflection, exactly as the first release of the
+ *       library did.
+ */
+static uint64_t errTest_Crc(uint8_t _width, uint64_t _Poly, uint64_t _Init, bool _refIn, bool _refOut, uint64_t _xorOut, const uint8_t *_data, size_t _dataLength)
+{
+    uint64_t _mask = (_width == 64) ? 0xFFFFFFFFFFFFFFFFULL : ((1ULL << _width) - 1ULL);
+    uint64_t _CRC = _Init & _mask;
+    uint64_t _byte = 0x00;
+    size_t _index = 0x00;
+    uint8_t _bit = 0x00;
+
+    for(_index = 0; _index < _dataLength; _index++)
+    {
+        _byte = _refIn ? errTest_Reflect(_data[_index], 8) : _data[_index];
+
+        for(_bit = 0; _bit < 8; _bit++)
+        {
+            if(bitCheckHigh(_CRC, _width - 1) ^ bitCheckHigh(_byte, 7 - _bit))
+            {
+                _CRC = ((_CRC << 1) ^ _Poly) & _mask;
+            }
+            else
+            {
+                _CRC = (_CRC << 1) & _mask;
+            };
+        };
+    };
+
+    _CRC = (_CRC ^ _xorOut) & _mask;
+
+    return _refOut ? errTest_Reflect(_CRC, _width) : _CRC;
+};
+
+
+/**
+ * @brief Reference byte sum of the additive checksums
+ */
+static uint32_t errTest_Sum(const uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Sum = 0x00;
+
+    while(_dataLength--)
+    {
+        _Sum += *_data++;
+    };
+
+    return _Sum;
+};
+
+
+/**
+ * @brief Reference Fletcher-16 / Adler-32 (bytes, one modulo per byte)
+ * @param _modulus 255 for Fletcher-16, 65521 for Adler-32
+ * @param _Sum1 Initial Sum1 (0 for Fletcher-16, 1 for Adler-32)
+ * @param _shift Position of Sum2 in the result (8 or 16)
+ */
+static uint32_t errTest_Fletcher(uint32_t _modulus, uint32_t _Sum1, uint8_t _shift, const uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Sum2 = 0x00;
+
+    while(_dataLength--)
+    {
+        _Sum1 = (_Sum1 + *_data++) % _modulus;
+        _Sum2 = (_Sum2 + _Sum1) % _modulus;
+    };
+
+    return (_Sum2 << _shift) | _Sum1;
+};
+
+
+/**
+ * @brief Reference Fletcher-32 (little endian words, odd byte padded)
+ */
+static uint32_t errTest_Fletcher32(const uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Sum1 = 0x00;
+    uint32_t _Sum2 = 0x00;
+    size_t _index = 0x00;
+
+    for(_index = 0; _index < _dataLength; _index += 2)
+    {
+        _Sum1 = (_Sum1 + (_data[_index] | (((_index + 1) < _dataLength) ? ((uint32_t)_data[_index + 1] << 8) : 0))) % 65535;
+        _Sum2 = (_Sum2 + _Sum1) % 65535;
+    };
+
+    return (_Sum2 << 16) | _Sum1;
+};
+
+
+/**
+ * @brief Reference Internet checksum (big endian words, odd byte padded)
+ */
+static uint16_t errTest_Inet(const uint8_t *_data, size_t _dataLength)
+{
+    uint32_t _Sum = 0x00;
+    size_t _index = 0x00;
+
+    for(_index = 0; _index < _dataLength; _index += 2)
+    {
+        _Sum += ((uint32_t)_data[_index] << 8) | (((_index + 1) < _dataLength) ? _data[_index + 1] : 0);
+        _Sum = (_Sum & 0xFFFF) + (_Sum >> 16);
+    };
+
+    return (uint16_t)~_Sum;
+};
+
+
+/**
+ * @brief Picks two split points 0 <= _a <= _b <= _length
+ */
+static void errTest_Split(uint32_t *_state, size_t _length, size_t *_a, size_t *_b)
+{
+    size_t _swap = 0x00;
+
+    *_a = errTest_Random(_state) % (_length + 1);
+    *_b = errTest_Random(_state) % (_length + 1);
+
+    if(*_a > *_b)
+    {
+        _swap = *_a;
+        *_a = *_b;
+        *_b = _swap;
+    };
+};
+
+
+/**
+ * @brief Cuts random frames (possibly empty or overlapping) out of a buffer
+ */
+static void errTest_Frames(uint32_t *_state, uint8_t *_data, size_t _length, errBuffer_T *_frames)
+{
+    size_t _index = 0x00;
+    size_t _start = 0x00;
+
+    for(_index = 0; _index < ERR_TEST_FRAMES; _index++)
+    {
+        _start = errTest_Random(_state) % (_length + 1);
+        _frames[_index].Data = _data + _start;
+        _frames[_index].Length = errTest_Random(_state) % (_length - _start + 1);
+    };
+};
+
+
+/**
+ * @brief Rewrites a random span (up to ERR_TEST_PATCH bytes) with random bytes
+ * @param _old Receives the original bytes of the span
+ * @param _offset Receives the offset of the span
+ * @return size_t Length of the span
+ */
+static size_t errTest_Patch(uint32_t *_state, uint8_t *_data, size_t _length, uint8_t *_old, size_t *_offset)
+{
+    size_t _span = 0x00;
+    size_t _index = 0x00;
+
+    *_offset = errTest_Random(_state) % (_length + 1);
+    _span = errTest_Random(_state) % (ERR_TEST_PATCH + 1);
+    if(_span > _length - *_offset)
+    {
+        _span = _length - *_offset;
+    };
+
+    for(_index = 0; _index < _span; _index++)
+    {
+        _old[_index] = _data[*_offset + _index];
+        _data[*_offset + _index] = (uint8_t)errTest_Random(_state);
+    };
+
+    return _span;
+};
+
+
+/**
+ * @brief Puts back the span saved by errTest_Patch
+ */
+static void errTest_Unpatch(uint8_t *_data, const uint8_t *_old, size_t _offset, size_t _span)
+{
+    size_t _index = 0x00;
+
+    for(_index = 0; _index < _span; _index++)
+    {
+        _data[_offset + _index] = _old[_index];
+    };
+};
+
+
+/**
+ * @brief Flips one bit of a frame, counted in CRC shift order
+ */
+static void errTest_Flip(uint8_t *_data, size_t _bit, bool _refIn)
+{
+    _data[_bit >> 3] ^= (uint8_t)(_refIn ? (0x01 << (_bit & 0x07)) : (0x80 >> (_bit & 0x07)));
+};
+
+
+/**
+ * @brief Injects a single-bit error (or a 2-bit payload burst) and corrects it
+ * @param _copy Error-free copy of the frame
+ * @param _result Result of CRCxx_Fix on the damaged frame
+ * @param _strong true when the error must be corrected (preset, single bit)
+ * @return bool true when the frame was restored, or left uncorrected where allowed
+ * 
+ * @note A corrected frame must match the copy exactly: a miscorrection fails.
+ *       The frame is restored from the copy afterwards.
+ */
+static bool errTest_Fixed(uint8_t *_data, const uint8_t *_copy, size_t _frameLength, errFix_T _result, bool _strong)
+{
+    bool _same = true;
+    size_t _index = 0x00;
+
+    for(_index = 0; _index < _frameLength; _index++)
+    {
+        _same = _same && (_data[_index] == _copy[_index]);
+        _data[_index] = _copy[_index];
+    };
+
+    return (_result == ERR_FIX_CORRECTED) ? _same : !_strong;
+};
+
+
+/**
+ * @brief Stores a CRC after a payload
+ * @param _frame Pointer to payload, the CRC goes at _frame[_length]
+ * @param _CRC CRC value
+ * @param _bytes CRC size in bytes
+ * @param _endian Byte order
+ */
+static void errTest_Store(uint8_t *_frame, size_t _length, uint32_t _CRC, uint8_t _bytes, errEndian_T _endian)
+{
+    uint8_t _index = 0x00;
+
+    for(_index = 0; _index < _bytes; _index++)
+    {
+        _frame[_length + ((_endian == ERR_ENDIAN_BIG) ? (_bytes - 1 - _index) : _index)] = (uint8_t)(_CRC >> (8 * _index));
+    };
+};
+
+
+/**
+ * @brief Runs every CRC8 backend for one configuration and buffer
+ * @return uint32_t Number of failed checks
+ */
+static uint32_t errTest_Crc8(uint32_t *_state, uint32_t _iteration, hcrc8_T *hcrc, uint8_t *_data, size_t _length)
+{
+    static hcrc8Table_T _table;
+    static hcrc8Nibble_T _nibble;
+    hcrc8Ctx_T _ctx;
+    errBuffer_T _segments[3];
+    errBuffer_T _frames[ERR_TEST_FRAMES];
+    uint8_t _results[ERR_TEST_FRAMES];
+    uint8_t _old[ERR_TEST_PATCH];
+    uint32_t _fails = 0x00;
+    uint8_t _ref = (uint8_t)errTest_Crc(8, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length);
+    uint8_t _bit = 0x00;
+    size_t _a = 0x00;
+    size_t _b = 0x00;
+    size_t _index = 0x00;
+
+    CRC8_TableInit(&_table, hcrc);
+    CRC8_NibbleInit(&_nibble, hcrc);
+    errTest_Split(_state, _length, &_a, &_b);
+
+    ERR_TEST(CRC8_Calc(hcrc, _data, (uint16_t)_length) == _ref, "CRC8_Calc");
+    ERR_TEST(CRC8_CalcLarge(hcrc, _data, _length) == _ref, "CRC8_CalcLarge");
+    ERR_TEST(CRC8_TableCalc(&_table, _data, _length) == _ref, "CRC8_TableCalc");
+    ERR_TEST(CRC8_NibbleCalc(&_nibble, _data, _length) == _ref, "CRC8_NibbleCalc");
+    ERR_TEST(CRC8_CachedCalc(hcrc, _data, _length) == _ref, "CRC8_CachedCalc");
+
+    CRC8_Init(&_ctx, hcrc);
+    CRC8_Update(&_ctx, _data, _a);
+    CRC8_Update(&_ctx, _data + _a, _b - _a);
+    CRC8_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC8_Final(&_ctx) == _ref, "CRC8_Update");
+
+    CRC8_InitTable(&_ctx, &_table);
+    CRC8_Update(&_ctx, _data, _a);
+    CRC8_Update(&_ctx, _data + _a, _b - _a);
+    CRC8_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC8_Final(&_ctx) == _ref, "CRC8_Update (table)");
+
+    CRC8_InitTable(&_ctx, &_table);
+    for(_index = 0; _index < _length; _index++)
+    {
+        CRC8_UpdateByte(&_ctx, _data[_index]);
+    };
+    ERR_TEST(CRC8_Final(&_ctx) == _ref, "CRC8_UpdateByte");
+
+    CRC8_InitCached(&_ctx, hcrc);
+    CRC8_Update(&_ctx, _data, _a);
+    CRC8_Update(&_ctx, _data + _a, _b - _a);
+    CRC8_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC8_Final(&_ctx) == _ref, "CRC8_Update (cached)");
+
+    _segments[0].Data = _data;
+    _segments[0].Length = _a;
+    _segments[1].Data = _data + _a;
+    _segments[1].Length = _b - _a;
+    _segments[2].Data = _data + _b;
+    _segments[2].Length = _length - _b;
+    ERR_TEST(CRC8_CalcSG(hcrc, _segments, 3) == _ref, "CRC8_CalcSG");
+
+    CRC8_InitTable(&_ctx, &_table);
+    CRC8_UpdateSG(&_ctx, _segments, 3);
+    ERR_TEST(CRC8_Final(&_ctx) == _ref, "CRC8_UpdateSG");
+
+    ERR_TEST(CRC8_Combine(CRC8_CalcLarge(hcrc, _data, _a), CRC8_CalcLarge(hcrc, _data + _a, _length - _a), _length - _a, hcrc) == _ref, "CRC8_Combine");
+
+    errTest_Frames(_state, _data, _length, _frames);
+    CRC8_BatchCalc(&_table, _frames, _results, ERR_TEST_FRAMES);
+    for(_index = 0; _index < ERR_TEST_FRAMES; _index++)
+    {
+        ERR_TEST(_results[_index] == (uint8_t)errTest_Crc(8, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _frames[_index].Data, _frames[_index].Length), "CRC8_BatchCalc");
+    };
+
+    _b = errTest_Patch(_state, _data, _length, _old, &_a);
+    ERR_TEST(CRC8_Patch(_ref, _length, _a, _old, _data + _a, _b, hcrc) == (uint8_t)errTest_Crc(8, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length), "CRC8_Patch");
+    errTest_Unpatch(_data, _old, _a, _b);
+
+    errTest_Store(_data, _length, _ref, 1, ERR_ENDIAN_LITTLE);
+    ERR_TEST(CRC8_Verify(hcrc, _data, _length + 1), "CRC8_Verify");
+    ERR_TEST(CRC8_TableVerify(&_table, _data, _length + 1), "CRC8_TableVerify");
+
+    if(hcrc->Poly != 0)
+    {
+        _a = errTest_Random(_state) % (_length + 1);
+        _bit = (uint8_t)(1 << (errTest_Random(_state) & 0x07));
+        _data[_a] ^= _bit;
+        ERR_TEST(!CRC8_Verify(hcrc, _data, _length + 1), "CRC8_Verify (error)");
+        ERR_TEST(!CRC8_TableVerify(&_table, _data, _length + 1), "CRC8_TableVerify (error)");
+        _data[_a] ^= _bit;
+    };
+
+    return _fails;
+};
+
+
+/**
+ * @brief Runs every CRC16 backend for one configuration and buffer
+ * @return uint32_t Number of failed checks
+ */
+static uint32_t errTest_Crc16(uint32_t *_state, uint32_t _iteration, hcrc16_T *hcrc, uint8_t *_data, size_t _length)
+{
+    static hcrc16Table_T _table;
+    static hcrc16Nibble_T _nibble;
+    hcrc16Ctx_T _ctx;
+    errBuffer_T _segments[3];
+    errBuffer_T _frames[ERR_TEST_FRAMES];
+    uint16_t _results[ERR_TEST_FRAMES];
+    errBuffer_T _halves[ERR_TEST_FRAMES];
+    hcrc16Multi_T _multi;
+    uint8_t _old[ERR_TEST_PATCH];
+    static hcrcFixEntry_T _fixEntries[ERR_FIX_ENTRIES(ERR_TEST_FIX, 16, 2)];
+    hcrc16Fix_T _fix;
+    uint8_t _copy[ERR_TEST_FIX + 2];
+    uint32_t _fails = 0x00;
+    uint16_t _ref = (uint16_t)errTest_Crc(16, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length);
+    errEndian_T _endian = (errEndian_T)(errTest_Random(_state) & 0x01);
+    uint8_t _bit = 0x00;
+    size_t _a = 0x00;
+    size_t _b = 0x00;
+    size_t _index = 0x00;
+
+    CRC16_TableInit(&_table, hcrc);
+    CRC16_NibbleInit(&_nibble, hcrc);
+    errTest_Split(_state, _length, &_a, &_b);
+
+    ERR_TEST(CRC16_Calc(hcrc, _data, (uint16_t)_length) == _ref, "CRC16_Calc");
+    ERR_TEST(CRC16_CalcLarge(hcrc, _data, _length) == _ref, "CRC16_CalcLarge");
+    ERR_TEST(CRC16_TableCalc(&_table, _data, _length) == _ref, "CRC16_TableCalc");
+    ERR_TEST(CRC16_NibbleCalc(&_nibble, _data, _length) == _ref, "CRC16_NibbleCalc");
+    ERR_TEST(CRC16_CachedCalc(hcrc, _data, _length) == _ref, "CRC16_CachedCalc");
+
+    CRC16_Init(&_ctx, hcrc);
+    CRC16_Update(&_ctx, _data, _a);
+    CRC16_Update(&_ctx, _data + _a, _b - _a);
+    CRC16_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC16_Final(&_ctx) == _ref, "CRC16_Update");
+
+    CRC16_InitTable(&_ctx, &_table);
+    CRC16_Update(&_ctx, _data, _a);
+    CRC16_Update(&_ctx, _data + _a, _b - _a);
+    CRC16_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC16_Final(&_ctx) == _ref, "CRC16_Update (table)");
+
+    CRC16_InitTable(&_ctx, &_table);
+    for(_index = 0; _index < _length; _index++)
+    {
+        CRC16_UpdateByte(&_ctx, _data[_index]);
+    };
+    ERR_TEST(CRC16_Final(&_ctx) == _ref, "CRC16_UpdateByte");
+
+    CRC16_InitCached(&_ctx, hcrc);
+    CRC16_Update(&_ctx, _data, _a);
+    CRC16_Update(&_ctx, _data + _a, _b - _a);
+    CRC16_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC16_Final(&_ctx) == _ref, "CRC16_Update (cached)");
+
+    _segments[0].Data = _data;
+    _segments[0].Length = _a;
+    _segments[1].Data = _data + _a;
+    _segments[1].Length = _b - _a;
+    _segments[2].Data = _data + _b;
+    _segments[2].Length = _length - _b;
+    ERR_TEST(CRC16_CalcSG(hcrc, _segments, 3) == _ref, "CRC16_CalcSG");
+
+    CRC16_InitTable(&_ctx, &_table);
+    CRC16_UpdateSG(&_ctx, _segments, 3);
+    ERR_TEST(CRC16_Final(&_ctx) == _ref, "CRC16_UpdateSG");
+
+    ERR_TEST(CRC16_Combine(CRC16_CalcLarge(hcrc, _data, _a), CRC16_CalcLarge(hcrc, _data + _a, _length - _a), _length - _a, hcrc) == _ref, "CRC16_Combine");
+
+    errTest_Frames(_state, _data, _length, _frames);
+    CRC16_BatchCalc(&_table, _frames, _results, ERR_TEST_FRAMES);
+    for(_index = 0; _index < ERR_TEST_FRAMES; _index++)
+    {
+        ERR_TEST(_results[_index] == (uint16_t)errTest_Crc(16, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _frames[_index].Data, _frames[_index].Length), "CRC16_BatchCalc");
+    };
+
+    for(_index = 0; (_index < ERR_TEST_FRAMES) && (_index < ERR_MULTI_LANES); _index++)
+    {
+        _segments[0].Data = _frames[_index].Data;
+        _segments[0].Length = _frames[_index].Length;
+        _frames[_index].Length = errTest_Random(_state) % (_segments[0].Length + 1);
+        _halves[_index].Data = _segments[0].Data + _frames[_index].Length;
+        _halves[_index].Length = _segments[0].Length - _frames[_index].Length;
+    };
+    ERR_TEST(CRC16_MultiInit(&_multi, &_table, NULL, (uint8_t)_index), "CRC16_MultiInit");
+    CRC16_MultiUpdate(&_multi, _frames);
+    CRC16_MultiUpdate(&_multi, _halves);
+    for(_index = 0; _index < _multi.Lanes; _index++)
+    {
+        ERR_TEST(CRC16_MultiFinal(&_multi, (uint8_t)_index) == _results[_index], "CRC16_MultiUpdate");
+    };
+
+    _b = errTest_Patch(_state, _data, _length, _old, &_a);
+    ERR_TEST(CRC16_Patch(_ref, _length, _a, _old, _data + _a, _b, hcrc) == (uint16_t)errTest_Crc(16, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length), "CRC16_Patch");
+    errTest_Unpatch(_data, _old, _a, _b);
+
+    errTest_Store(_data, _length, _ref, 2, _endian);
+    ERR_TEST(CRC16_Verify(hcrc, _data, _length + 2, _endian), "CRC16_Verify");
+    ERR_TEST(CRC16_TableVerify(&_table, _data, _length + 2, _endian), "CRC16_TableVerify");
+
+    /* every fourth iteration runs a preset, whose single-bit errors must all be corrected */
+    if(_length <= ERR_TEST_FIX)
+    {
+        for(_index = 0; _index < _length + 2; _index++)
+        {
+            _copy[_index] = _data[_index];
+        };
+        ERR_TEST(CRC16_FixInit(&_fix, &_table, _length + 2, 2, _fixEntries, ERR_FIX_ENTRIES(ERR_TEST_FIX, 16, 2)) && (CRC16_Fix(&_fix, _data, _endian) == ERR_FIX_NONE), "CRC16_FixInit");
+
+        _a = errTest_Random(_state) % (8 * (_length + 2));
+        _b = ((_a + 1 < 8 * _length) && (errTest_Random(_state) & 0x01)) ? 2 : 1;
+        errTest_Flip(_data, _a, hcrc->refIn);
+        if(_b == 2)
+        {
+            errTest_Flip(_data, _a + 1, hcrc->refIn);
+        };
+        ERR_TEST(errTest_Fixed(_data, _copy, _length + 2, CRC16_Fix(&_fix, _data, _endian), ((_iteration & 0x03) == 0) && (_b == 1)), "CRC16_Fix");
+    };
+
+    if(hcrc->Poly != 0)
+    {
+        _a = errTest_Random(_state) % (_length + 2);
+        _bit = (uint8_t)(1 << (errTest_Random(_state) & 0x07));
+        _data[_a] ^= _bit;
+        ERR_TEST(!CRC16_Verify(hcrc, _data, _length + 2, _endian), "CRC16_Verify (error)");
+        ERR_TEST(!CRC16_TableVerify(&_table, _data, _length + 2, _endian), "CRC16_TableVerify (error)");
+        _data[_a] ^= _bit;
+    };
+
+    return _fails;
+};
+
+
+/**
+ * @brief Runs every CRC32 backend for one configuration and buffer
+ * @return uint32_t Number of failed checks
+ */
+static uint32_t errTest_Crc32(uint32_t *_state, uint32_t _iteration, hcrc32_T *hcrc, uint8_t *_data, size_t _length)
+{
+    static hcrc32Table_T _table;
+    static hcrc32Nibble_T _nibble;
+    static hcrc32Slice_T _slice;
+    hcrc32Ctx_T _ctx;
+    herrPipe_T _pipe;
+    errBuffer_T _segments[3];
+    errBuffer_T _frames[ERR_TEST_FRAMES];
+    uint32_t _results[ERR_TEST_FRAMES];
+    uint8_t _old[ERR_TEST_PATCH];
+    static hcrcFixEntry_T _fixEntries[ERR_FIX_ENTRIES(ERR_TEST_FIX, 32, 2)];
+    hcrc32Fix_T _fix;
+    uint8_t _copy[ERR_TEST_FIX + 4];
+    uint32_t _fails = 0x00;
+    uint32_t _ref = (uint32_t)errTest_Crc(32, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length);
+    errEndian_T _endian = (errEndian_T)(errTest_Random(_state) & 0x01);
+    uint8_t _bit = 0x00;
+    size_t _a = 0x00;
+    size_t _b = 0x00;
+    size_t _index = 0x00;
+
+    CRC32_TableInit(&_table, hcrc);
+    CRC32_SliceInit(&_slice, hcrc);
+    CRC32_NibbleInit(&_nibble, hcrc);
+    errTest_Split(_state, _length, &_a, &_b);
+
+    ERR_TEST(CRC32_Calc(hcrc, _data, (uint16_t)_length) == _ref, "CRC32_Calc");
+    ERR_TEST(CRC32_CalcLarge(hcrc, _data, _length) == _ref, "CRC32_CalcLarge");
+    ERR_TEST(CRC32_TableCalc(&_table, _data, _length) == _ref, "CRC32_TableCalc");
+    ERR_TEST(CRC32_NibbleCalc(&_nibble, _data, _length) == _ref, "CRC32_NibbleCalc");
+    ERR_TEST(CRC32_CachedCalc(hcrc, _data, _length) == _ref, "CRC32_CachedCalc");
+    ERR_TEST(CRC32_SliceCalc(&_slice, _data, _length) == _ref, "CRC32_SliceCalc");
+
+    CRC32_Init(&_ctx, hcrc);
+    CRC32_Update(&_ctx, _data, _a);
+    CRC32_Update(&_ctx, _data + _a, _b - _a);
+    CRC32_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC32_Final(&_ctx) == _ref, "CRC32_Update");
+
+    CRC32_InitTable(&_ctx, &_table);
+    CRC32_Update(&_ctx, _data, _a);
+    CRC32_Update(&_ctx, _data + _a, _b - _a);
+    CRC32_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC32_Final(&_ctx) == _ref, "CRC32_Update (table)");
+
+    CRC32_InitTable(&_ctx, &_table);
+    for(_index = 0; _index < _length; _index++)
+    {
+        CRC32_UpdateByte(&_ctx, _data[_index]);
+    };
+    ERR_TEST(CRC32_Final(&_ctx) == _ref, "CRC32_UpdateByte");
+
+    CRC32_InitCached(&_ctx, hcrc);
+    CRC32_Update(&_ctx, _data, _a);
+    CRC32_Update(&_ctx, _data + _a, _b - _a);
+    CRC32_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC32_Final(&_ctx) == _ref, "CRC32_Update (cached)");
+
+    CRC32_InitSlice(&_ctx, &_slice);
+    CRC32_Update(&_ctx, _data, _a);
+    CRC32_Update(&_ctx, _data + _a, _b - _a);
+    CRC32_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRC32_Final(&_ctx) == _ref, "CRC32_Update (slice)");
+
+    _segments[0].Data = _data;
+    _segments[0].Length = _a;
+    _segments[1].Data = _data + _a;
+    _segments[1].Length = _b - _a;
+    _segments[2].Data = _data + _b;
+    _segments[2].Length = _length - _b;
+    ERR_TEST(CRC32_CalcSG(hcrc, _segments, 3) == _ref, "CRC32_CalcSG");
+
+    CRC32_InitTable(&_ctx, &_table);
+    CRC32_UpdateSG(&_ctx, _segments, 3);
+    ERR_TEST(CRC32_Final(&_ctx) == _ref, "CRC32_UpdateSG");
+
+    ERR_TEST(CRC32_Combine(CRC32_CalcLarge(hcrc, _data, _a), CRC32_CalcLarge(hcrc, _data + _a, _length - _a), _length - _a, hcrc) == _ref, "CRC32_Combine");
+
+    errTest_Frames(_state, _data, _length, _frames);
+    CRC32_BatchCalc(&_table, _frames, _results, ERR_TEST_FRAMES);
+    for(_index = 0; _index < ERR_TEST_FRAMES; _index++)
+    {
+        ERR_TEST(_results[_index] == errTest_Crc(32, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _frames[_index].Data, _frames[_index].Length), "CRC32_BatchCalc");
+    };
+
+    _b = errTest_Patch(_state, _data, _length, _old, &_a);
+    ERR_TEST(CRC32_Patch(_ref, _length, _a, _old, _data + _a, _b, hcrc) == (uint32_t)errTest_Crc(32, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length), "CRC32_Patch");
+    errTest_Unpatch(_data, _old, _a, _b);
+
+    errTest_Store(_data, _length, _ref, 4, _endian);
+    ERR_TEST(CRC32_Verify(hcrc, _data, _length + 4, _endian), "CRC32_Verify");
+    ERR_TEST(CRC32_TableVerify(&_table, _data, _length + 4, _endian), "CRC32_TableVerify");
+
+    /* every fourth iteration runs a preset, whose single-bit errors must all be corrected */
+    if(_length <= ERR_TEST_FIX)
+    {
+        for(_index = 0; _index < _length + 4; _index++)
+        {
+            _copy[_index] = _data[_index];
+        };
+        ERR_TEST(CRC32_FixInit(&_fix, &_table, _length + 4, 2, _fixEntries, ERR_FIX_ENTRIES(ERR_TEST_FIX, 32, 2)) && (CRC32_Fix(&_fix, _data, _endian) == ERR_FIX_NONE), "CRC32_FixInit");
+
+        _a = errTest_Random(_state) % (8 * (_length + 4));
+        _b = ((_a + 1 < 8 * _length) && (errTest_Random(_state) & 0x01)) ? 2 : 1;
+        errTest_Flip(_data, _a, hcrc->refIn);
+        if(_b == 2)
+        {
+            errTest_Flip(_data, _a + 1, hcrc->refIn);
+        };
+        ERR_TEST(errTest_Fixed(_data, _copy, _length + 4, CRC32_Fix(&_fix, _data, _endian), ((_iteration & 0x03) == 0) && (_b == 1)), "CRC32_Fix");
+    };
+
+    errPipe_Init(&_pipe, &_table, _length + 4, _endian, NULL, NULL);
+    _a = errTest_Random(_state) % (_length + 4);
+    errPipe_Feed(&_pipe, _data, _a);
+    errPipe_Feed(&_pipe, _data + _a, _length + 4 - _a);
+    errPipe_Feed(&_pipe, _data, _length + 4);
+    ERR_TEST((_pipe.Frames == 2) && (_pipe.Errors == 0), "errPipe_Feed");
+
+    if(hcrc->Poly != 0)
+    {
+        _a = errTest_Random(_state) % (_length + 4);
+        _bit = (uint8_t)(1 << (errTest_Random(_state) & 0x07));
+        _data[_a] ^= _bit;
+        ERR_TEST(!CRC32_Verify(hcrc, _data, _length + 4, _endian), "CRC32_Verify (error)");
+        ERR_TEST(!CRC32_TableVerify(&_table, _data, _length + 4, _endian), "CRC32_TableVerify (error)");
+        errPipe_Feed(&_pipe, _data, _length + 4);
+        ERR_TEST((_pipe.Frames == 3) && (_pipe.Errors == 1), "errPipe_Feed (error)");
+        _data[_a] ^= _bit;
+    };
+
+    return _fails;
+};
+
+
+/**
+ * @brief Runs every generic CRC engine for one random configuration and buffer
+ * @return uint32_t Number of failed checks
+ * 
+ * @note Widths 8, 16 and 32 are also checked against CRC8/16/32_CalcLarge.
+ */
+static uint32_t errTest_CrcN(uint32_t *_state, uint32_t _iteration, uint8_t *_data, size_t _length)
+{
+    static hcrcNTable_T _table;
+    static hcrcNNibble_T _nibble;
+    hcrcNCtx_T _ctx;
+    hcrcN_T _crcN;
+    hcrc8_T _crc8;
+    hcrc16_T _crc16;
+    hcrc32_T _crc32;
+    uint32_t _fails = 0x00;
+    uint64_t _ref = 0x00;
+    size_t _a = 0x00;
+    size_t _b = 0x00;
+
+    _crcN.Width = (uint8_t)(3 + (errTest_Random(_state) % 62));
+    _crcN.Poly = ((uint64_t)errTest_Random(_state) << 32) | errTest_Random(_state);
+    _crcN.Init = ((uint64_t)errTest_Random(_state) << 32) | errTest_Random(_state);
+    _crcN.refIn = errTest_Random(_state) & 0x01;
+    _crcN.refOut = errTest_Random(_state) & 0x01;
+    _crcN.xorOut = ((uint64_t)errTest_Random(_state) << 32) | errTest_Random(_state);
+    if((_iteration & 0x03) == 0x03)
+    {
+        _crcN.Width = (uint8_t)(8 << (errTest_Random(_state) % 3));
+    };
+
+    _ref = errTest_Crc(_crcN.Width, _crcN.Poly, _crcN.Init, _crcN.refIn, _crcN.refOut, _crcN.xorOut, _data, _length);
+    CRCN_TableInit(&_table, &_crcN);
+    CRCN_NibbleInit(&_nibble, &_crcN);
+    errTest_Split(_state, _length, &_a, &_b);
+
+    ERR_TEST(CRCN_Calc(&_crcN, _data, _length) == _ref, "CRCN_Calc");
+    ERR_TEST(CRCN_TableCalc(&_table, _data, _length) == _ref, "CRCN_TableCalc");
+    ERR_TEST(CRCN_NibbleCalc(&_nibble, _data, _length) == _ref, "CRCN_NibbleCalc");
+
+    CRCN_Init(&_ctx, &_crcN);
+    CRCN_Update(&_ctx, _data, _a);
+    CRCN_Update(&_ctx, _data + _a, _b - _a);
+    CRCN_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRCN_Final(&_ctx) == _ref, "CRCN_Update");
+
+    CRCN_InitTable(&_ctx, &_table);
+    CRCN_Update(&_ctx, _data, _a);
+    CRCN_Update(&_ctx, _data + _a, _b - _a);
+    CRCN_Update(&_ctx, _data + _b, _length - _b);
+    ERR_TEST(CRCN_Final(&_ctx) == _ref, "CRCN_Update (table)");
+
+    if(_crcN.Width == 8)
+    {
+        _crc8.Poly = (uint8_t)_crcN.Poly;
+        _crc8.Init = (uint8_t)_crcN.Init;
+        _crc8.refIn = _crcN.refIn;
+        _crc8.refOut = _crcN.refOut;
+        _crc8.xorOut = (uint8_t)_crcN.xorOut;
+        ERR_TEST(CRC8_CalcLarge(&_crc8, _data, _length) == _ref, "CRCN_Calc (CRC8)");
+    }
+    else if(_crcN.Width == 16)
+    {
+        _crc16.Poly = (uint16_t)_crcN.Poly;
+        _crc16.Init = (uint16_t)_crcN.Init;
+        _crc16.refIn = _crcN.refIn;
+        _crc16.refOut = _crcN.refOut;
+        _crc16.xorOut = (uint16_t)_crcN.xorOut;
+        ERR_TEST(CRC16_CalcLarge(&_crc16, _data, _length) == _ref, "CRCN_Calc (CRC16)");
+    }
+    else if(_crcN.Width == 32)
+    {
+        _crc32.Poly = (uint32_t)_crcN.Poly;
+        _crc32.Init = (uint32_t)_crcN.Init;
+        _crc32.refIn = _crcN.refIn;
+        _crc32.refOut = _crcN.refOut;
+        _crc32.xorOut = (uint32_t)_crcN.xorOut;
+        ERR_TEST(CRC32_CalcLarge(&_crc32, _data, _length) == _ref, "CRCN_Calc (CRC32)");
+    };
+
+    return _fails;
+};
+
+
+/**
+ * @brief Runs every checksum backend for one buffer
+ * @return uint32_t Number of failed checks
+ */
+static uint32_t errTest_Sums(uint32_t *_state, uint32_t _iteration, uint8_t *_data, size_t _length)
+{
+    errBuffer_T _segments[3];
+    hfletcher16Ctx_T _fletcher16;
+    hfletcher32Ctx_T _fletcher32;
+    hadler32Ctx_T _adler32;
+    hcheckSumInetCtx_T _inet;
+    uint8_t _old[ERR_TEST_PATCH];
+    uint32_t _fails = 0x00;
+    uint32_t _ref = errTest_Sum(_data, _length);
+    size_t _a = 0x00;
+    size_t _b = 0x00;
+
+    errTest_Split(_state, _length, &_a, &_b);
+
+    ERR_TEST(checkSum8_Calc(_data, (uint16_t)_length) == (uint8_t)_ref, "checkSum8_Calc");
+    ERR_TEST(checkSum16_Calc(_data, (uint16_t)_length) == (uint16_t)_ref, "checkSum16_Calc");
+    ERR_TEST(checkSum32_Calc(_data, (uint16_t)_length) == _ref, "checkSum32_Calc");
+    ERR_TEST(checkSum8_CalcLarge(_data, _length) == (uint8_t)_ref, "checkSum8_CalcLarge");
+    ERR_TEST(checkSum16_CalcLarge(_data, _length) == (uint16_t)_ref, "checkSum16_CalcLarge");
+    ERR_TEST(checkSum32_CalcLarge(_data, _length) == _ref, "checkSum32_CalcLarge");
+
+    _segments[0].Data = _data;
+    _segments[0].Length = _a;
+    _segments[1].Data = _data + _a;
+    _segments[1].Length = _b - _a;
+    _segments[2].Data = _data + _b;
+    _segments[2].Length = _length - _b;
+    ERR_TEST(checkSum8_CalcSG(_segments, 3) == (uint8_t)_ref, "checkSum8_CalcSG");
+    ERR_TEST(checkSum16_CalcSG(_segments, 3) == (uint16_t)_ref, "checkSum16_CalcSG");
+    ERR_TEST(checkSum32_CalcSG(_segments, 3) == _ref, "checkSum32_CalcSG");
+
+    _ref = errTest_Fletcher(255, 0, 8, _data, _length);
+    ERR_TEST(Fletcher16_Calc(_data, _length) == _ref, "Fletcher16_Calc");
+    Fletcher16_Init(&_fletcher16);
+    Fletcher16_Update(&_fletcher16, _data, _a);
+    Fletcher16_Update(&_fletcher16, _data + _a, _b - _a);
+    Fletcher16_Update(&_fletcher16, _data + _b, _length - _b);
+    ERR_TEST(Fletcher16_Final(&_fletcher16) == _ref, "Fletcher16_Update");
+
+    _ref = errTest_Fletcher32(_data, _length);
+    ERR_TEST(Fletcher32_Calc(_data, _length) == _ref, "Fletcher32_Calc");
+    Fletcher32_Init(&_fletcher32);
+    Fletcher32_Update(&_fletcher32, _data, _a);
+    Fletcher32_Update(&_fletcher32, _data + _a, _b - _a);
+    Fletcher32_Update(&_fletcher32, _data + _b, _length - _b);
+    ERR_TEST(Fletcher32_Final(&_fletcher32) == _ref, "Fletcher32_Update");
+
+    _ref = errTest_Fletcher(65521, 1, 16, _data, _length);
+    ERR_TEST(Adler32_Calc(_data, _length) == _ref, "Adler32_Calc");
+    Adler32_Init(&_adler32);
+    Adler32_Update(&_adler32, _data, _a);
+    Adler32_Update(&_adler32, _data + _a, _b - _a);
+    Adler32_Update(&_adler32, _data + _b, _length - _b);
+    ERR_TEST(Adler32_Final(&_adler32) == _ref, "Adler32_Update");
+
+    _ref = errTest_Inet(_data, _length);
+    ERR_TEST(checkSumInet_Calc(_data, _length) == _ref, "checkSumInet_Calc");
+    checkSumInet_Init(&_inet);
+    checkSumInet_Update(&_inet, _data, _a);
+    checkSumInet_Update(&_inet, _data + _a, _b - _a);
+    checkSumInet_Update(&_inet, _data + _b, _length - _b);
+    ERR_TEST(checkSumInet_Final(&_inet) == _ref, "checkSumInet_Update");
+
+    _ref = errTest_Sum(_data, _length);
+    _b = errTest_Patch(_state, _data, _length, _old, &_a);
+    ERR_TEST(checkSum8_Patch((uint8_t)_ref, _old, _data + _a, _b) == (uint8_t)errTest_Sum(_data, _length), "checkSum8_Patch");
+    ERR_TEST(checkSum16_Patch((uint16_t)_ref, _old, _data + _a, _b) == (uint16_t)errTest_Sum(_data, _length), "checkSum16_Patch");
+    ERR_TEST(checkSum32_Patch(_ref, _old, _data + _a, _b) == errTest_Sum(_data, _length), "checkSum32_Patch");
+    errTest_Unpatch(_data, _old, _a, _b);
+
+    return _fails;
+};
+
+
+/**
+ * @brief Checks every selectable kernel of the dispatch layer against the reference
+ * @return uint32_t Number of failed checks
+ * 
+ * @note The selection of each family is restored afterwards.
+ */
+static uint32_t errTest_Kernels(uint32_t _iteration, hcrc8_T *hcrc8, hcrc16_T *hcrc16, hcrc32_T *hcrc32, uint8_t *_data, size_t _length)
+{
+    uint32_t _fails = 0x00;
+    uint32_t _sum = errTest_Sum(_data, _length);
+    uint8_t _ref8 = (uint8_t)errTest_Crc(8, hcrc8->Poly, hcrc8->Init, hcrc8->refIn, hcrc8->refOut, hcrc8->xorOut, _data, _length);
+    uint16_t _ref16 = (uint16_t)errTest_Crc(16, hcrc16->Poly, hcrc16->Init, hcrc16->refIn, hcrc16->refOut, hcrc16->xorOut, _data, _length);
+    uint32_t _ref32 = (uint32_t)errTest_Crc(32, hcrc32->Poly, hcrc32->Init, hcrc32->refIn, hcrc32->refOut, hcrc32->xorOut, _data, _length);
+    errKernel_T _saved[ERR_DISPATCH_COUNT];
+    uint8_t _family = 0x00;
+    uint8_t _kernel = 0x00;
+
+    for(_family = 0; _family < ERR_DISPATCH_COUNT; _family++)
+    {
+        _saved[_family] = err_KernelGet((errDispatch_T)_family);
+    };
+
+    for(_kernel = ERR_KERNEL_AUTO; _kernel < ERR_KERNEL_COUNT; _kernel++)
+    {
+        if(err_KernelSet(ERR_DISPATCH_CRC8, (errKernel_T)_kernel))
+        {
+            ERR_TEST(err_KernelGet(ERR_DISPATCH_CRC8) == (errKernel_T)_kernel, "err_KernelGet");
+            ERR_TEST(CRC8_CalcLarge(hcrc8, _data, _length) == _ref8, "CRC8_CalcLarge (kernel)");
+        };
+        if(err_KernelSet(ERR_DISPATCH_CRC16, (errKernel_T)_kernel))
+        {
+            ERR_TEST(CRC16_CalcLarge(hcrc16, _data, _length) == _ref16, "CRC16_CalcLarge (kernel)");
+        };
+        if(err_KernelSet(ERR_DISPATCH_CRC32, (errKernel_T)_kernel))
+        {
+            ERR_TEST(CRC32_CalcLarge(hcrc32, _data, _length) == _ref32, "CRC32_CalcLarge (kernel)");
+        };
+        if(err_KernelSet(ERR_DISPATCH_SUM, (errKernel_T)_kernel))
+        {
+            ERR_TEST(checkSum8_CalcLarge(_data, _length) == (uint8_t)_sum, "checkSum8_CalcLarge (kernel)");
+            ERR_TEST(checkSum16_CalcLarge(_data, _length) == (uint16_t)_sum, "checkSum16_CalcLarge (kernel)");
+            ERR_TEST(checkSum32_CalcLarge(_data, _length) == _sum, "checkSum32_CalcLarge (kernel)");
+        };
+        ERR_TEST(err_KernelAvailable(ERR_DISPATCH_SUM, (errKernel_T)_kernel) == (err_KernelGet(ERR_DISPATCH_SUM) == (errKernel_T)_kernel)
+                 || (_kernel == ERR_KERNEL_AUTO), "err_KernelAvailable");
+    };
+
+    for(_family = 0; _family < ERR_DISPATCH_COUNT; _family++)
+    {
+        err_KernelSet((errDispatch_T)_family, _saved[_family]);
+    };
+
+    return _fails;
+};
+
+
+
+#if ERR_STATS
+/**
+ * @brief Checks that instrumented calls and verifies are counted
+ * @return uint32_t Number of failed checks
+ * 
+ * @note Compares snapshots taken around the calls, so the counters are not
+ *       reset and concurrent callers can only add to the differences.
+ */
+static uint32_t errTest_Stats(uint32_t _iteration, hcrc8_T *hcrc8, uint8_t *_data, size_t _length)
+{
+    uint32_t _fails = 0x00;
+    errStats_T _before;
+    errStats_T _after;
+
+    err_StatsGet(&_before);
+    (void)CRC8_CalcLarge(hcrc8, _data, _length);
+    (void)CRC8_Verify(hcrc8, _data, 0);
+    err_StatsGet(&_after);
+
+    ERR_TEST(_after.Algo[ERR_ALGO_CRC8].Calls >= _before.Algo[ERR_ALGO_CRC8].Calls + 2, "err_StatsGet (calls)");
+    ERR_TEST(_after.Algo[ERR_ALGO_CRC8].Bytes >= _before.Algo[ERR_ALGO_CRC8].Bytes + _length, "err_StatsGet (bytes)");
+    ERR_TEST(_after.Kernel[ERR_KERNEL_AUTO].Calls == _before.Kernel[ERR_KERNEL_AUTO].Calls, "err_StatsGet (auto kernel charged)");
+    ERR_TEST(_after.Verified >= _before.Verified + 1, "err_StatsGet (verified)");
+    ERR_TEST(_after.Mismatches >= _before.Mismatches + 1, "err_StatsGet (mismatches)");
+
+    return _fails;
+};
+
+
+/**
+ * @brief Checks that calls are charged to the kernel that processed them
+ * @param _data Pointer to ERR_TEST_BUFFER bytes
+ * @return uint32_t Number of failed checks
+ * 
+ * @note Runs before the random rounds: they fill the table caches with
+ *       random configurations, after which table-sized buffers of a new
+ *       configuration run bitwise.
+ */
+static uint32_t errTest_StatsKernels(uint32_t _iteration, uint8_t *_data)
+{
+    hcrc8_T _crc8 = CRC8_MAXIM;
+    hcrc16_T _crc16 = CRC16_MODBUS;
+    hcrc32_T _crc32 = CRC32C;
+    uint32_t _fails = 0x00;
+    errStats_T _before;
+    errStats_T _after;
+    errKernel_T _table8 = (ERR_TABLE_CACHE_8 > 0) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE;
+    errKernel_T _table16 = (ERR_TABLE_CACHE_16 > 0) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE;
+    errKernel_T _table32 = (ERR_TABLE_CACHE_32 > 0) ? ERR_KERNEL_TABLE : ERR_KERNEL_BITWISE;
+    errKernel_T _multi8 = ERR_KERNEL_TABLE;
+    static hcrc16Table_T _table;
+    hcrc16Multi_T _multi;
+    errBuffer_T _lanes[8];
+    uint8_t _index = 0x00;
+
+#if ERR_HW_SIMD && defined(__x86_64__) && defined(__GNUC__)
+    if(__builtin_cpu_supports("ssse3"))
+    {
+        _multi8 = ERR_KERNEL_SIMD;
+    };
+#endif
+
+    if(err_KernelAvailable(ERR_DISPATCH_CRC16, ERR_KERNEL_CLMUL))
+    {
+        _table16 = ERR_KERNEL_CLMUL;
+    };
+
+    if(err_KernelAvailable(ERR_DISPATCH_CRC32, ERR_KERNEL_HW))
+    {
+        _table32 = ERR_KERNEL_HW;
+    }
+    else if(err_KernelAvailable(ERR_DISPATCH_CRC32, ERR_KERNEL_CLMUL))
+    {
+        _table32 = ERR_KERNEL_CLMUL;
+    };
+
+    err_StatsGet(&_before);
+    (void)CRC8_CalcLarge(&_crc8, _data, ERR_DISPATCH_MIN_LENGTH - 1);
+    err_StatsGet(&_after);
+    ERR_TEST(_after.Kernel[ERR_KERNEL_BITWISE].Calls == _before.Kernel[ERR_KERNEL_BITWISE].Calls + 1, "err_StatsGet (CRC8 short buffer kernel)");
+
+    err_StatsGet(&_before);
+    (void)CRC8_CalcLarge(&_crc8, _data, ERR_TEST_BUFFER);
+    err_StatsGet(&_after);
+    ERR_TEST(_after.Kernel[_table8].Calls == _before.Kernel[_table8].Calls + 1, "err_StatsGet (CRC8 kernel)");
+
+    err_StatsGet(&_before);
+    (void)CRC16_CalcLarge(&_crc16, _data, ERR_TEST_BUFFER);
+    err_StatsGet(&_after);
+    ERR_TEST(_after.Kernel[_table16].Calls == _before.Kernel[_table16].Calls + 1, "err_StatsGet (CRC16 kernel)");
+
+    err_StatsGet(&_before);
+    (void)CRC32_CalcLarge(&_crc32, _data, ERR_TEST_BUFFER);
+    err_StatsGet(&_after);
+    ERR_TEST(_after.Kernel[_table32].Calls == _before.Kernel[_table32].Calls + 1, "err_StatsGet (CRC32 kernel)");
+    ERR_TEST(_after.Kernel[_table32].Bytes == _before.Kernel[_table32].Bytes + ERR_TEST_BUFFER, "err_StatsGet (CRC32 kernel bytes)");
+
+    err_StatsGet(&_before);
+    (void)checkSum32_CalcLarge(_data, ERR_TEST_BUFFER);
+    err_StatsGet(&_after);
+    ERR_TEST(_after.Kernel[err_KernelGet(ERR_DISPATCH_SUM)].Calls == _before.Kernel[err_KernelGet(ERR_DISPATCH_SUM)].Calls + 1, "err_StatsGet (checksum kernel)");
+
+    CRC16_TableInit(&_table, &_crc16);
+    for(_index = 0; _index < 8; _index++)
+    {
+        _lanes[_index].Data = _data + _index * 64;
+        _lanes[_index].Length = 64;
+    };
+
+    (void)CRC16_MultiInit(&_multi, &_table, NULL, 4);
+    err_StatsGet(&_before);
+    CRC16_MultiUpdate(&_multi, _lanes);
+    err_StatsGet(&_after);
+    ERR_TEST(_after.Kernel[ERR_KERNEL_TABLE].Calls == _before.Kernel[ERR_KERNEL_TABLE].Calls + 1, "err_StatsGet (CRC16_MultiUpdate four lanes)");
+
+    (void)CRC16_MultiInit(&_multi, &_table, NULL, 8);
+    err_StatsGet(&_before);
+    CRC16_MultiUpdate(&_multi, _lanes);
+    err_StatsGet(&_after);
+    ERR_TEST(_after.Kernel[_multi8].Calls == _before.Kernel[_multi8].Calls + 1, "err_StatsGet (CRC16_MultiUpdate eight lanes)");
+
+    return _fails;
+};
+#endif
+
+#if ERR_PRESETS
+/**
+ * @brief Checks every preset function against its configuration
+ * @return uint32_t Number of failed checks
+ */
+static uint32_t errTest_Presets(uint32_t _iteration, uint8_t *_data, size_t _length)
+{
+    static const hcrc8_T _crc8[4] = {CRC8_MAXIM, CRC8_NRSC5, CRC8_ATM, CRC8_SAE_J1850};
+    static const hcrc16_T _crc16[2] = {CRC16_MODBUS, CRC16_CCITT_FALSE};
+    static const hcrc32_T _crc32[2] = {CRC32_ISO_HDLC, CRC32C};
+    uint32_t _fails = 0x00;
+
+    ERR_TEST(CRC8_MAXIM_Calc(_data, _length) == errTest_Crc(8, _crc8[0].Poly, _crc8[0].Init, _crc8[0].refIn, _crc8[0].refOut, _crc8[0].xorOut, _data, _length), "CRC8_MAXIM_Calc");
+    ERR_TEST(CRC8_NRSC5_Calc(_data, _length) == errTest_Crc(8, _crc8[1].Poly, _crc8[1].Init, _crc8[1].refIn, _crc8[1].refOut, _crc8[1].xorOut, _data, _length), "CRC8_NRSC5_Calc");
+    ERR_TEST(CRC8_ATM_Calc(_data, _length) == errTest_Crc(8, _crc8[2].Poly, _crc8[2].Init, _crc8[2].refIn, _crc8[2].refOut, _crc8[2].xorOut, _data, _length), "CRC8_ATM_Calc");
+    ERR_TEST(CRC8_SAE_J1850_Calc(_data, _length) == errTest_Crc(8, _crc8[3].Poly, _crc8[3].Init, _crc8[3].refIn, _crc8[3].refOut, _crc8[3].xorOut, _data, _length), "CRC8_SAE_J1850_Calc");
+    ERR_TEST(CRC16_MODBUS_Calc(_data, _length) == errTest_Crc(16, _crc16[0].Poly, _crc16[0].Init, _crc16[0].refIn, _crc16[0].refOut, _crc16[0].xorOut, _data, _length), "CRC16_MODBUS_Calc");
+    ERR_TEST(CRC16_CCITT_FALSE_Calc(_data, _length) == errTest_Crc(16, _crc16[1].Poly, _crc16[1].Init, _crc16[1].refIn, _crc16[1].refOut, _crc16[1].xorOut, _data, _length), "CRC16_CCITT_FALSE_Calc");
+    ERR_TEST(CRC32_ISO_HDLC_Calc(_data, _length) == errTest_Crc(32, _crc32[0].Poly, _crc32[0].Init, _crc32[0].refIn, _crc32[0].refOut, _crc32[0].xorOut, _data, _length), "CRC32_ISO_HDLC_Calc");
+    ERR_TEST(CRC32C_Calc(_data, _length) == errTest_Crc(32, _crc32[1].Poly, _crc32[1].Init, _crc32[1].refIn, _crc32[1].refOut, _crc32[1].xorOut, _data, _length), "CRC32C_Calc");
+
+    return _fails;
+};
+#endif
+
+
+/**
+ * @brief Checks the multi-threaded and file CRC-32 of err_host.h
+ * @param hpool Pool started with a small chunk, so short buffers are split
+ * @param htiny Pool started with a one-byte chunk, so buffers shorter than
+ *              its thread count are split as well
+ * @param _path Scratch file receiving the buffer
+ * @return uint32_t Number of failed checks
+ */
+static uint32_t errTest_Host(uint32_t *_state, uint32_t _iteration, herrPool_T *hpool, herrPool_T *htiny, const char *_path, hcrc32_T *hcrc, uint8_t *_data, size_t _length)
+{
+    static hcrc32Table_T _table;
+    FILE *_file = NULL;
+    uint32_t _fails = 0x00;
+    uint32_t _ref = (uint32_t)errTest_Crc(32, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length);
+    uint32_t _CRC = 0x00;
+
+    CRC32_TableInit(&_table, hcrc);
+
+    ERR_TEST(CRC32_ParallelCalc(hpool, &_table, _data, _length) == _ref, "CRC32_ParallelCalc");
+    ERR_TEST(CRC32_ParallelCalc(htiny, &_table, _data, _length & 0x07) == (uint32_t)errTest_Crc(32, hcrc->Poly, hcrc->Init, hcrc->refIn, hcrc->refOut, hcrc->xorOut, _data, _length & 0x07), "CRC32_ParallelCalc (one-byte chunk)");
+
+    _file = fopen(_path, "wb");
+    ERR_TEST((_file != NULL) && (fwrite(_data, 1, _length, _file) == _length) && (fclose(_file) == 0), "CRC32_FileCalc (write)");
+    ERR_TEST(CRC32_FileCalc((errTest_Random(_state) & 0x01) ? hpool : NULL, &_table, _path, &_CRC) && (_CRC == _ref), "CRC32_FileCalc");
+
+    return _fails;
+};
+
+
+/**
+ * @brief Cross-checks every checksum and CRC backend against the reference
+ * @param _seed Seed of the random generator (0 is replaced by 1)
+ * @param _iterations Number of random rounds
+ * @return uint32_t Number of failed checks, 0 when every backend matches
+ * 
+ * @note Every round fills the buffer with random bytes and picks a random
+ *       offset (0..7), length and split points. It then runs random
+ *       CRC8/16/32 configurations (every 4th round a standard preset)
+ *       and generic CRC-3..64 configurations through all engines -
+ *       bitwise, table, slicing, hardware CRC, carry-less folding and
+ *       SIMD, whichever the build and CPU use - as
+ *       one-shot, streaming, scatter-gather, combine, batch and verify
+ *       calls, and all checksum variants, and compares each result with
+ *       the bitwise reference of the original implementation.
+ *       Every round also runs the host extensions (err_host.h) on the
+ *       same buffer. Failed checks are printed by errTest_Report.
+ */
+static uint32_t errTest_Run(herrPool_T *hpool, herrPool_T *htiny, const char *_path, uint32_t _seed, uint32_t _iterations)
+{
+    static uint8_t _buffer[ERR_TEST_BUFFER + 16];
+    static const hcrc8_T _crc8Presets[4] = {CRC8_MAXIM, CRC8_NRSC5, CRC8_ATM, CRC8_SAE_J1850};
+    static const hcrc16_T _crc16Presets[2] = {CRC16_MODBUS, CRC16_CCITT_FALSE};
+    static const hcrc32_T _crc32Presets[2] = {CRC32_ISO_HDLC, CRC32C};
+    uint32_t _state = (_seed == 0) ? 1 : _seed;
+    uint32_t _fails = 0x00;
+    uint32_t _iteration = 0x00;
+    uint8_t *_data = NULL;
+    size_t _length = 0x00;
+    size_t _index = 0x00;
+    hcrc8_T _crc8;
+    hcrc16_T _crc16;
+    hcrc32_T _crc32;
+
+#if ERR_STATS
+    _fails += errTest_StatsKernels(0, _buffer);
+#endif
+
+    for(_iteration = 0; _iteration < _iterations; _iteration++)
+    {
+        for(_index = 0; _index < sizeof(_buffer); _index++)
+        {
+            _buffer[_index] = (uint8_t)errTest_Random(&_state);
+        };
+
+        _data = _buffer + (errTest_Random(&_state) & 0x07);
+        _length = errTest_Random(&_state) % ((_iteration & 0x01) ? 64 : (ERR_TEST_BUFFER + 1));
+
+        if((_iteration & 0x03) == 0)
+        {
+            _crc8 = _crc8Presets[errTest_Random(&_state) & 0x03];
+            _crc16 = _crc16Presets[errTest_Random(&_state) & 0x01];
+            _crc32 = _crc32Presets[errTest_Random(&_state) & 0x01];
+        }
+        else
+        {
+            _crc8.Poly = (uint8_t)errTest_Random(&_state);
+            _crc8.Init = (uint8_t)errTest_Random(&_state);
+            _crc8.refIn = errTest_Random(&_state) & 0x01;
+            _crc8.refOut = errTest_Random(&_state) & 0x01;
+            _crc8.xorOut = (uint8_t)errTest_Random(&_state);
+            _crc16.Poly = (uint16_t)errTest_Random(&_state);
+            _crc16.Init = (uint16_t)errTest_Random(&_state);
+            _crc16.refIn = errTest_Random(&_state) & 0x01;
+            _crc16.refOut = errTest_Random(&_state) & 0x01;
+            _crc16.xorOut = (uint16_t)errTest_Random(&_state);
+            _crc32.Poly = errTest_Random(&_state);
+            _crc32.Init = errTest_Random(&_state);
+            _crc32.refIn = errTest_Random(&_state) & 0x01;
+            _crc32.refOut = errTest_Random(&_state) & 0x01;
+            _crc32.xorOut = errTest_Random(&_state);
+        };
+
+        _fails += errTest_Sums(&_state, _iteration, _data, _length);
+        _fails += errTest_Crc8(&_state, _iteration, &_crc8, _data, _length);
+        _fails += errTest_Crc16(&_state, _iteration, &_crc16, _data, _length);
+        _fails += errTest_Crc32(&_state, _iteration, &_crc32, _data, _length);
+        _fails += errTest_CrcN(&_state, _iteration, _data, _length);
+        _fails += errTest_Kernels(_iteration, &_crc8, &_crc16, &_crc32, _data, _length);
+#if ERR_STATS
+        _fails += errTest_Stats(_iteration, &_crc8, _data, _length);
+#endif
+#if ERR_PRESETS
+        _fails += errTest_Presets(_iteration, _data, _length);
+#endif
+        _fails += errTest_Host(&_state, _iteration, hpool, htiny, _path, &_crc32, _data, _length);
+    };
+
+    return _fails;
+};
+
+
+/**
+ * @brief Parses a decimal command line number
+ * @param _text Argument text
+ * @param _value Receives the value
+ * @return bool false when the text is empty or not a number
+ */
+static bool errTest_Number(const char *_text, uint32_t *_value)
+{
+    char *_end = NULL;
+    unsigned long _number = strtoul(_text, &_end, 10);
+
+    if((_text[0] == '\0') || (*_end != '\0') || (_number > 0xFFFFFFFFUL))
+    {
+        return false;
+    };
+
+    *_value = (uint32_t)_number;
+
+    return true;
+};
+
+
+int main(int argc, char **argv)
+{
+    char _path[] = "/tmp/err_test.XXXXXX";
+    herrPool_T _pool;
+    herrPool_T _tiny;
+    uint32_t _seed = 0x12345678UL;
+    uint32_t _iterations = 1000;
+    uint32_t _fails = 0x00;
+    int _file = -1;
+
+    if((argc > 3) || ((argc > 1) && !errTest_Number(argv[1], &_seed)) || ((argc > 2) && !errTest_Number(argv[2], &_iterations)))
+    {
+        fprintf(stderr, "usage: %s [seed [iterations]]\n", argv[0]);
+        return EXIT_FAILURE;
+    };
+
+    _file = mkstemp(_path);
+    if((_file < 0) || !errPool_Init(&_pool, 4, 64) || !errPool_Init(&_tiny, 4, 1))
+    {
+        fprintf(stderr, "%s: cannot create the scratch file or the worker pool\n", argv[0]);
+        return EXIT_FAILURE;
+    };
+    close(_file);
+
+    _fails = errTest_Run(&_pool, &_tiny, _path, _seed, _iterations);
+
+    errPool_DeInit(&_tiny);
+    errPool_DeInit(&_pool);
+    unlink(_path);
+
+    printf("%lu rounds, seed %lu: %lu failed checks\n", (unsigned long)_iterations, (unsigned long)_seed, (unsigned long)_fails);
+
+    return (_fails == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+};
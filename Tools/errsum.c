@@ -0,0 +1,124 @@
+/**
+ * @file     errsum.c
+ * @brief    Error Detection Library - file checksum command line tool
+ * @note     Prints the CRC-32 or CRC-32C of files, one line per file in the
+ *           "crc  name" form of cksum-like tools:
+ *
+ *               errsum [--crc32 | --crc32c] [-j threads] file...
+ *
+ *           "-" (or no file) reads standard input. Large files are memory
+ *           mapped and computed on all CPUs (-j 1 for a single thread).
+ *
+ *           Build (Linux/macOS, aKaReZa.h on the include path):
+ *
+ *               cc -O2 -I../Sources -I<aKaReZa.h dir> -o errsum errsum.c \
+ *                  ../Sources/err.c ../Sources/err_host.c -lpthread
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     For detailed explanations, usage examples, and implementation notes,
+ *           please visit the repository:
+ *           https://github.com/aKaReZa75/Error_Detection
+ */
+#include "err_host.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/**
+ * @brief Prints the command line help
+ * @param _name Program name
+ */
+static void errsum_Usage(const char *_name)
+{
+    fprintf(stderr, "usage: %s [--crc32 | --crc32c] [-j threads] [file...]\n", _name);
+    fprintf(stderr, "  --crc32     CRC-32/ISO-HDLC (Ethernet, ZIP, PNG), default\n");
+    fprintf(stderr, "  --crc32c    CRC-32C (Castagnoli, iSCSI)\n");
+    fprintf(stderr, "  -j threads  worker threads, 0 = all CPUs (default)\n");
+};
+
+
+int main(int argc, char **argv)
+{
+    hcrc32_T _crc32 = CRC32_ISO_HDLC;
+    hcrc32_T _crc32c = CRC32C;
+    hcrc32_T *hcrc = &_crc32;
+    hcrc32Table_T _table;
+    herrPool_T _pool;
+    herrPool_T *hpool = NULL;
+    const char *_path = NULL;
+    char *_end = NULL;
+    uint32_t _CRC = 0x00;
+    long _threads = 0x00;
+    int _first = 0x00;
+    int _index = 0x00;
+    int _status = EXIT_SUCCESS;
+
+    for(_index = 1; _index < argc; _index++)
+    {
+        if(strcmp(argv[_index], "--crc32") == 0)
+        {
+            hcrc = &_crc32;
+        }
+        else if(strcmp(argv[_index], "--crc32c") == 0)
+        {
+            hcrc = &_crc32c;
+        }
+        else if((strcmp(argv[_index], "-j") == 0) && (_index + 1 < argc))
+        {
+            _index++;
+            _threads = strtol(argv[_index], &_end, 10);
+            if((_end == argv[_index]) || (*_end != '\0') || (_threads < 0) || (_threads > ERR_POOL_MAX_THREADS))
+            {
+                errsum_Usage(argv[0]);
+                return EXIT_FAILURE;
+            };
+        }
+        else if(strcmp(argv[_index], "--") == 0)
+        {
+            _index++;
+            break;
+        }
+        else if((argv[_index][0] == '-') && (argv[_index][1] != '\0'))
+        {
+            errsum_Usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            break;
+        };
+    };
+    _first = _index;
+
+    CRC32_TableInit(&_table, hcrc);
+
+    if((_threads != 1) && errPool_Init(&_pool, (uint16_t)_threads, 0))
+    {
+        hpool = &_pool;
+    };
+
+    for(_index = _first; (_index < argc) || (_index == _first); _index++)
+    {
+        _path = (_index < argc) ? argv[_index] : "-";
+
+        if(!CRC32_FileCalc(hpool, &_table, (strcmp(_path, "-") == 0) ? "/dev/stdin" : _path, &_CRC))
+        {
+            fprintf(stderr, "%s: %s: %s\n", argv[0], _path, strerror(errno));
+            _status = EXIT_FAILURE;
+            continue;
+        };
+
+        printf("%08lx  %s\n", (unsigned long)_CRC, _path);
+    };
+
+    if(hpool != NULL)
+    {
+        errPool_DeInit(hpool);
+    };
+
+    return _status;
+};
\ No newline at end of file